@@ -30,12 +30,14 @@
 #include "Aircraft.h"
 #include "Category.h"
 #include "DataTables.h"
-#include "TextNode.h"
 #include <memory>
 #include <string>
 #include "Utility.h"
 #include "CommandQueue.h"
 #include "SoundNode.h"
+#include "AnimationManager.h"
+#include "ExplosionNode.h"
+#include "RecycledMemory.h"
 #include <functional>
 
 using namespace std::placeholders;
@@ -45,18 +47,27 @@ namespace GEX
 	//Make it private to this file
 	namespace
 	{
-		const std::map<AircraftType, AircraftData> TABLE = initializeAircraftData();
+		const AircraftTable& TABLE = getAircraftTable();
 	}
 
+	std::size_t Aircraft::liveAircraft_ = 0;
+	std::size_t Aircraft::lazyBytes_ = 0;
+
 	//Aircraft Constructor - Get texture based on the type and set airplane position
 	Aircraft::Aircraft(AircraftType type, TextureManager & textures)
-		: Entity(TABLE.at(type).hitpoints)
+		: Entity(TABLE[toIndex(type)].hitpoints)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
-		, explosion_(textures.get(TextureID::Explosion))
+		, textures_(textures)
+		, sprite_(textures.get(TABLE[toIndex(type)].texture), TABLE[toIndex(type)].textureRect)
+		, explosion_()
 		, showExplosion_(true)
-		, healthDisplay_(nullptr)
-		, missileDisplay_(nullptr)
+		, explosions_(nullptr)
+		, labels_(nullptr)
+		, particles_(nullptr)
+		, healthDisplay_()
+		, missileDisplay_()
+		, displayedHitpoints_(-1)
+		, displayedMissileAmmo_(-1)
 		, travelDistance_(0.f)
 		, directionIndex_(0)
 		, isFiring_(false)
@@ -66,17 +77,11 @@ namespace GEX
 		, fireCountdown_(sf::Time::Zero)
 		, spawnPickup_(false)
 		, fireCommand_()
-		, missileAmmo_(TABLE.at(type).missileAmount)
+		, missileAmmo_(TABLE[toIndex(type)].missileAmount)
 		, isMarkedForRemoval_(false)
 		, hasPlayedExplosionSound_(false)
 	{
 
-		//Set up the explosion
-		explosion_.setFrameSize(sf::Vector2i(256, 256));
-		explosion_.setNumFrames(16);
-		explosion_.setDuration(sf::seconds(1));
-		centerOrigin(explosion_);
-
 		//Set up commands
 		fireCommand_.category = Category::AirSceneLayer;
 		fireCommand_.action = [this, &textures](SceneNode& node, sf::Time dt) 
@@ -90,37 +95,53 @@ namespace GEX
 			createProjectile(node, Projectile::Type::Missile, 0.f, 0.5f, textures);
 		};
 
-		dropPickupCommand_.category = Category::AirSceneLayer;
-		dropPickupCommand_.action = [this, &textures](SceneNode& node, sf::Time dt)
-		{
-			createPickup(node, textures);
-		};
-
 		centerOrigin(sprite_);
 
-		//Creating health display and attaching to the graph
-		std::unique_ptr<TextNode> health(new TextNode(std::string("")));
-		healthDisplay_ = health.get();
-		attachChild(std::move(health));
-
-		//Creating missile display and attaching to the graph
-		std::unique_ptr<TextNode> missile(new TextNode(""));
-		missileDisplay_ = missile.get();
-		attachChild(std::move(missile));
+		++liveAircraft_;
+	}
 
+	Aircraft::~Aircraft()
+	{
+		lazyBytes_ -= (healthDisplay_ ? sizeof(Label) : 0) + (missileDisplay_ ? sizeof(Label) : 0) + (explosion_ ? sizeof(Animation) : 0);
+		--liveAircraft_;
 	}
 
 	//Draw the current 
-	void Aircraft::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Aircraft::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
-		if (isDestroyed() && showExplosion_)
+		if (isDestroyed())
 		{
-			target.draw(explosion_, states);
+			if (explosion_ && showExplosion_)
+			{
+				target.draw(*explosion_, states);
+			}
 		}
 		else
 		{
 			target.draw(sprite_, states);
 		}
+
+		if (labels_)
+		{
+			if (healthDisplay_)
+			{
+				labels_->submit(*healthDisplay_, states.transform);
+			}
+			if (missileDisplay_)
+			{
+				labels_->submit(*missileDisplay_, states.transform);
+			}
+		}
+	}
+
+	void* Aircraft::operator new(std::size_t size)
+	{
+		return RecycledMemory<Aircraft>::allocate(size);
+	}
+
+	void Aircraft::operator delete(void* memory, std::size_t size)
+	{
+		RecycledMemory<Aircraft>::release(memory, size);
 	}
 
 	unsigned int Aircraft::getCategory() const
@@ -139,31 +160,63 @@ namespace GEX
 		}
 	}
 
+	DrawDepth Aircraft::getDrawDepth() const
+	{
+		return isDestroyed() ? DrawDepth::Explosion : DrawDepth::Aircraft;
+	}
+
 	void Aircraft::updateTexts()
 	{
-		sf::Color color = sf::Color::White;
-		if (getHitpoints() <= 20)
+		//Health and missile displays are drawn by the label batch
+		Label& healthDisplay = healthDisplay_ ? *healthDisplay_ : createLabel(healthDisplay_, sf::Vector2f(0.f, 50.f));
+
+		//Only rebuild the texts when the values change
+		if (getHitpoints() != displayedHitpoints_)
 		{
-			color = sf::Color::Red;
+			displayedHitpoints_ = getHitpoints();
+
+			sf::Color color = sf::Color::White;
+			if (getHitpoints() <= 20)
+			{
+				color = sf::Color::Red;
+			}
+
+			healthDisplay.setText(std::to_string(getHitpoints()) + "HP", color);
 		}
+		healthDisplay.setRotation(-getRotation());
 
-		healthDisplay_->setText(std::to_string(getHitpoints()) + "HP", color);
-		healthDisplay_->setPosition(0.f, 50.f);
-		healthDisplay_->setRotation(-getRotation());
-		if (isAllied())
+		if (isAllied() && missileAmmo_ != displayedMissileAmmo_)
 		{
+			Label& missileDisplay = missileDisplay_ ? *missileDisplay_ : createLabel(missileDisplay_, sf::Vector2f(0.f, 70.f));
+
+			displayedMissileAmmo_ = missileAmmo_;
+
 			sf::Color color = sf::Color::Green;
 			if (missileAmmo_ <= 2) {
 				color = sf::Color::Red;
 			} 
-			missileDisplay_->setText("Missile: " + std::to_string(missileAmmo_), color);
-			missileDisplay_->setPosition(0.f, 70.f);
+			missileDisplay.setText("Missile: " + std::to_string(missileAmmo_), color);
 		}
 	}
 
+	void Aircraft::setLabelBatch(const LabelBatchNode* labels)
+	{
+		labels_ = labels;
+	}
+
+	void Aircraft::setParticleRegistry(const ParticleRegistry* particles)
+	{
+		particles_ = particles;
+	}
+
+	void Aircraft::setExplosionSystem(ExplosionNode* explosions)
+	{
+		explosions_ = explosions;
+	}
+
 	void Aircraft::fire()
 	{
-		if (TABLE.at(type_).fireInterval != sf::Time::Zero)
+		if (TABLE[toIndex(type_)].fireInterval != sf::Time::Zero)
 		{
 			isFiring_ = true;
 		}
@@ -202,7 +255,8 @@ namespace GEX
 
 	bool Aircraft::isMarkedForRemoval() const
 	{
-		return (isDestroyed() && (explosion_.isFinished() || !showExplosion_));
+		// The explosion system plays the explosion, nothing is left to show
+		return (isDestroyed() && (explosions_ || !showExplosion_ || (explosion_ && explosion_->isFinished())));
 	}
 
 	void Aircraft::remove()
@@ -213,9 +267,9 @@ namespace GEX
 
 	void Aircraft::updateLateralRoll()
 	{
-		if (TABLE.at(type_).hasRollAnimation)
+		if (TABLE[toIndex(type_)].hasRollAnimation)
 		{
-			auto textureRect = TABLE.at(type_).textureRect;
+			auto textureRect = TABLE[toIndex(type_)].textureRect;
 			if (getVelocity().x < 0.f) // Turn left
 			{
 				textureRect.left = textureRect.width;
@@ -243,20 +297,34 @@ namespace GEX
 
 	void Aircraft::updateCurrent(sf::Time dt, CommandQueue& commands)
 	{
-		checkProjectilelaunch(dt, commands);
+		// A wreck pushes no command that refers to it, it may be removed before they run
 		if (isDestroyed())
 		{
 			checkPickupDrop(commands);
-			explosion_.update(dt);
 			if (!hasPlayedExplosionSound_)
 			{
 				hasPlayedExplosionSound_ = true;
 				SoundEffectID effect = (randomInt(2) == 0 ? SoundEffectID::Explosion1 : SoundEffectID::Explosion2);
 				playLocalSound(commands, effect);
+
+				if (explosions_ && showExplosion_)
+				{
+					explosions_->add(getWorldPosition());
+				}
+				else if (showExplosion_)
+				{
+					createExplosion();
+				}
+			}
+
+			if (explosion_)
+			{
+				explosion_->update(dt);
 			}
 			
 			return;
 		}
+		checkProjectilelaunch(dt, commands);
 		Entity::updateCurrent(dt, commands);
 		if(!isDestroyed())
 		{
@@ -268,10 +336,41 @@ namespace GEX
 		
 	}
 
+	std::size_t Aircraft::getLiveAircraft()
+	{
+		return liveAircraft_;
+	}
+
+	std::size_t Aircraft::getAverageFootprint()
+	{
+		if (liveAircraft_ == 0)
+		{
+			return 0;
+		}
+		return sizeof(Aircraft) + lazyBytes_ / liveAircraft_;
+	}
+
+	Label& Aircraft::createLabel(std::unique_ptr<Label>& label, sf::Vector2f position)
+	{
+		label.reset(new Label());
+		label->setPosition(position);
+		lazyBytes_ += sizeof(Label);
+		return *label;
+	}
+
+	void Aircraft::createExplosion()
+	{
+		//The clip itself is shared by all aircraft
+		const sf::Texture& texture = textures_.get(TextureID::Explosion);
+		explosion_.reset(new Animation(AnimationManager::getInstance().get(AnimationID::Explosion, texture), texture));
+		centerOrigin(*explosion_);
+		lazyBytes_ += sizeof(Animation);
+	}
+
 	void Aircraft::updateMovementPattern(sf::Time dt)
 	{
 		// Movement pattern
-		const std::vector<Direction>& directions = TABLE.at(type_).directions;
+		const std::vector<Direction>& directions = TABLE[toIndex(type_)].directions;
 		if (!directions.empty())
 		{
 			if (travelDistance_ > directions.at(directionIndex_).distance)
@@ -291,7 +390,7 @@ namespace GEX
 
 	float Aircraft::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return TABLE[toIndex(type_)].speed;
 	}
 
 	void Aircraft::createBullets(SceneNode & node, TextureManager & texture)
@@ -317,7 +416,7 @@ namespace GEX
 	void Aircraft::createProjectile(SceneNode & node, Projectile::Type type, float xOffset, float yOffset, const TextureManager & textures)
 	{
 		//Create the projectile
-		std::unique_ptr<Projectile> projectile(new Projectile(type, textures));
+		std::unique_ptr<Projectile> projectile(new Projectile(type, textures, particles_));
 		
 		//Deal with the projectile position
 		sf::Vector2f offset(xOffset * sprite_.getGlobalBounds().width, yOffset * sprite_.getGlobalBounds().height);
@@ -344,7 +443,7 @@ namespace GEX
 			commands.push(fireCommand_);
 			playLocalSound(commands, isAllied() ? SoundEffectID::AlliedGunfire : SoundEffectID::EnemyGunfire);
 			isFiring_ = false;
-			fireCountdown_ = TABLE.at(type_).fireInterval / (fireRateLevel_ + 1.f);
+			fireCountdown_ = TABLE[toIndex(type_)].fireInterval / (fireRateLevel_ + 1.f);
 		}
 		else if(fireCountdown_ > sf::Time::Zero)
 		{
@@ -370,18 +469,22 @@ namespace GEX
 	{
 		if (!isAllied() && randomInt(2) == 0 && !spawnPickup_)
 		{
-			command.push(dropPickupCommand_);
+			// Bound to the position, the wreck is gone when the command runs
+			Command dropPickupCommand;
+			dropPickupCommand.category = Category::AirSceneLayer;
+			dropPickupCommand.action = std::bind(&Aircraft::createPickup, _1, std::ref(textures_), getWorldPosition());
+			command.push(dropPickupCommand);
 		}
 
 		spawnPickup_ = true;
 	}
 
-	void Aircraft::createPickup(SceneNode & node, TextureManager & texture)
+	void Aircraft::createPickup(SceneNode & node, TextureManager & texture, sf::Vector2f position)
 	{
 		auto type = static_cast<Pickup::Type>(randomInt(static_cast<int>(Pickup::Type::Count)));
 
 		std::unique_ptr<Pickup> pickup(new Pickup(type, texture));
-		pickup->setPosition(getWorldPosition());
+		pickup->setPosition(position);
 		pickup->setVelocity(0.f, 0.f);
 		node.attachChild(std::move(pickup));
 	}
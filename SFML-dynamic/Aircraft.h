@@ -35,25 +35,37 @@
 #include "Command.h"
 #include "Projectile.h"
 #include "Animation.h"
+#include "LabelBatchNode.h"
+#include <memory>
 
 namespace GEX
 {
 	class CommandQueue;
-	class TextNode;
+	class ParticleRegistry;
+	class ExplosionNode;
 
 	//Types of aircraft
-	enum class AircraftType { Eagle, Raptor, Avenger};
+	enum class AircraftType { Eagle, Raptor, Avenger, Count };
 
 	class Aircraft : public Entity
 	{
 	public:
 		explicit		Aircraft(AircraftType type, TextureManager& textures);
+						~Aircraft();
 
-		virtual void	drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		// Enemies come and go with the level, their memory is reused
+		static void*	operator new(std::size_t size);
+		static void		operator delete(void* memory, std::size_t size);
+
+		virtual void	drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
 		unsigned int	getCategory() const override;
+		DrawDepth		getDrawDepth() const override;	//its explosion is drawn over the other aircraft
 
 		void			updateTexts(); //update the mini health and missile display
+		void			setLabelBatch(const LabelBatchNode* labels); //where the displays are drawn
+		void			setParticleRegistry(const ParticleRegistry* particles); //binds the emitters of missiles
+		void			setExplosionSystem(ExplosionNode* explosions); //plays the explosion, so the wreck is removed at once
 
 		void			fire();
 		void			launchMissile() { isLaunchingMissile_ = true; };
@@ -74,6 +86,10 @@ namespace GEX
 
 		void			playLocalSound(CommandQueue& commands, SoundEffectID effect);
 
+		// For the stats overlay, the HUD and the explosion are counted once created
+		static std::size_t	getLiveAircraft();
+		static std::size_t	getAverageFootprint(); //bytes, not counting the label glyphs
+
 	protected:
 		void			updateCurrent(sf::Time dt, CommandQueue& commands) override;
 
@@ -91,17 +107,26 @@ namespace GEX
 		
 		void			checkProjectilelaunch(sf::Time dt, CommandQueue& commands);
 
+		Label&			createLabel(std::unique_ptr<Label>& label, sf::Vector2f position);
+		void			createExplosion();
+
 		void			checkPickupDrop(CommandQueue& command);
-		void			createPickup(SceneNode& node, TextureManager& texture);
+		static void		createPickup(SceneNode& node, TextureManager& texture, sf::Vector2f position);
 
 	private:
 		AircraftType	type_;
+		TextureManager&	textures_;
 		sf::Sprite		sprite_;
-		Animation		explosion_;
+		std::unique_ptr<Animation>	explosion_;	//created on destruction, only without an explosion system
 		bool			showExplosion_;
+		ExplosionNode*	explosions_;
 
-		TextNode*		healthDisplay_;
-		TextNode*		missileDisplay_;
+		const LabelBatchNode*	labels_;
+		const ParticleRegistry*	particles_;
+		std::unique_ptr<Label>	healthDisplay_;		//created on the first update
+		std::unique_ptr<Label>	missileDisplay_;	//player only
+		int				displayedHitpoints_;
+		int				displayedMissileAmmo_;
 
 		float			travelDistance_;
 		std::size_t		directionIndex_;
@@ -116,11 +141,13 @@ namespace GEX
 
 		Command			fireCommand_;
 		Command			launchMissileCommand_;
-		Command			dropPickupCommand_;
 
 		bool			spawnPickup_;
 
 		bool			hasPlayedExplosionSound_;
 
+		static std::size_t	liveAircraft_;
+		static std::size_t	lazyBytes_;	//labels and explosions of the live aircraft
+
 	};
 }
@@ -0,0 +1,143 @@
+/**
+* @file
+* AllocationTracker
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::size_t ZoneCount = static_cast<std::size_t>(AllocationZone::Count);
+
+		// Plain arrays of atomics, constant initialized so they work before main
+		std::atomic<std::uint64_t>		zoneCounts[ZoneCount];
+		std::atomic<std::uint64_t>		zoneBytes[ZoneCount];
+
+		thread_local AllocationZone		currentZone = AllocationZone::Other;
+	}
+
+	bool AllocationTracker::isEnabled()
+	{
+#ifdef GEX_TRACK_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	AllocationZoneStats AllocationTracker::getStats()
+	{
+		AllocationZoneStats stats;
+		for (std::size_t i = 0; i < ZoneCount; ++i)
+		{
+			stats[i].count = zoneCounts[i].load(std::memory_order_relaxed);
+			stats[i].bytes = zoneBytes[i].load(std::memory_order_relaxed);
+		}
+		return stats;
+	}
+
+	AllocationStats AllocationTracker::getTotal(const AllocationZoneStats& stats)
+	{
+		AllocationStats total{ 0, 0 };
+		for (const AllocationStats& zone : stats)
+		{
+			total.count += zone.count;
+			total.bytes += zone.bytes;
+		}
+		return total;
+	}
+
+	const char* AllocationTracker::getZoneName(AllocationZone zone)
+	{
+		switch (zone)
+		{
+		case AllocationZone::Input:			return "Input";
+		case AllocationZone::Update:		return "Update";
+		case AllocationZone::Collision:		return "Collision";
+		case AllocationZone::SceneUpdate:	return "Scene";
+		case AllocationZone::Spawn:			return "Spawn";
+		case AllocationZone::Snapshot:		return "Snapshot";
+		case AllocationZone::Render:		return "Render";
+		default:							return "Other";
+		}
+	}
+
+	void AllocationTracker::record(std::size_t bytes)
+	{
+		std::size_t zone = static_cast<std::size_t>(currentZone);
+		zoneCounts[zone].fetch_add(1, std::memory_order_relaxed);
+		zoneBytes[zone].fetch_add(bytes, std::memory_order_relaxed);
+	}
+
+	AllocationScope::AllocationScope(AllocationZone zone)
+		: previousZone_(currentZone)
+	{
+		currentZone = zone;
+	}
+
+	AllocationScope::~AllocationScope()
+	{
+		currentZone = previousZone_;
+	}
+}
+
+#ifdef GEX_TRACK_ALLOCATIONS
+
+// The nothrow and sized forms of the standard library end up here too
+void* operator new(std::size_t size)
+{
+	GEX::AllocationTracker::record(size);
+
+	void* memory = std::malloc(size == 0 ? 1 : size);
+	if (!memory)
+	{
+		throw std::bad_alloc();
+	}
+	return memory;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+	std::free(memory);
+}
+
+#endif // GEX_TRACK_ALLOCATIONS
@@ -0,0 +1,88 @@
+/**
+* @file
+* AllocationTracker
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Heap allocations are only counted when GEX_TRACK_ALLOCATIONS is defined in the project settings
+// It replaces the global operator new, so it is left out of normal builds
+
+namespace GEX
+{
+	// Where an allocation happened, set by AllocationScope on the allocating thread
+	enum class AllocationZone
+	{
+		Other,
+		Input,
+		Update,
+		Collision,
+		SceneUpdate,
+		Spawn,
+		Snapshot,
+		Render,
+		Count
+	};
+
+	struct AllocationStats
+	{
+		std::uint64_t		count;
+		std::uint64_t		bytes;
+	};
+
+	using AllocationZoneStats = std::array<AllocationStats, static_cast<std::size_t>(AllocationZone::Count)>;
+
+	class AllocationTracker
+	{
+	public:
+		static bool					isEnabled();
+
+		// Running totals since the start, subtract two of them to get a frame
+		static AllocationZoneStats	getStats();
+		static AllocationStats		getTotal(const AllocationZoneStats& stats);
+
+		static const char*			getZoneName(AllocationZone zone);
+
+		static void					record(std::size_t bytes); //called by operator new
+	};
+
+	class AllocationScope
+	{
+	public:
+		explicit					AllocationScope(AllocationZone zone);
+									~AllocationScope();
+
+									AllocationScope(const AllocationScope&) = delete;
+		AllocationScope&			operator=(const AllocationScope&) = delete;
+
+	private:
+		AllocationZone				previousZone_;
+	};
+}
@@ -28,94 +28,64 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 #include "Animation.h"
+#include <SFML/Graphics/Vertex.hpp>
 
 namespace GEX
 {
 	Animation::Animation()
-		: sprite_()
-		, frameSize_()
-		, numberOfFrames_(0)
-		, currentFrame_(0)
-		, duration_(sf::Time::Zero)
+		: clip_(nullptr)
+		, texture_(nullptr)
 		, elapsedTime_(sf::Time::Zero)
-		, repeat_(false)
 	{
 	}
 
-	Animation::Animation(const sf::Texture & texture)
-		: sprite_(texture)
-		, frameSize_()
-		, numberOfFrames_(0)
-		, currentFrame_(0)
-		, duration_(sf::Time::Zero)
+	Animation::Animation(const AnimationClip& clip, const sf::Texture & texture)
+		: clip_(&clip)
+		, texture_(&texture)
 		, elapsedTime_(sf::Time::Zero)
-		, repeat_(false)
 	{
 	}
 
-	void Animation::setTexture(const sf::Texture& texture)
+	void Animation::setClip(const AnimationClip& clip, const sf::Texture& texture)
 	{
-		sprite_.setTexture(texture);
+		clip_ = &clip;
+		texture_ = &texture;
+		elapsedTime_ = sf::Time::Zero;
 	}
 
-	const sf::Texture * Animation::getTexture() const
+	const AnimationClip * Animation::getClip() const
 	{
-		return sprite_.getTexture();
+		return clip_;
 	}
 
-	void Animation::setFrameSize(sf::Vector2i framesize)
+	const sf::Texture * Animation::getTexture() const
 	{
-		frameSize_ = framesize;
+		return texture_;
 	}
 
 	sf::Vector2i Animation::getFrameSize() const
 	{
-		return frameSize_;
-	}
-
-	void Animation::setNumFrames(std::size_t numFrames)
-	{
-		numberOfFrames_ = numFrames;
-	}
-
-	std::size_t Animation::getNumFrames() const
-	{
-		return numberOfFrames_;
-	}
-
-	void Animation::setDuration(sf::Time time)
-	{
-		duration_ = time;
-	}
-
-	sf::Time Animation::getDuration() const
-	{
-		return duration_;
+		return clip_ ? clip_->getFrameSize() : sf::Vector2i();
 	}
 
-	void Animation::setRepeating(bool repeat)
+	std::size_t Animation::getCurrentFrame() const
 	{
-		repeat_ = repeat;
-	}
-
-	bool Animation::isRepeating() const
-	{
-		return repeat_;
+		return clip_->getFrameIndex(elapsedTime_);
 	}
 
 	void Animation::restart()
 	{
-		currentFrame_ = 0;
+		elapsedTime_ = sf::Time::Zero;
 	}
 
 	bool Animation::isFinished() const
 	{
-		return currentFrame_ >= numberOfFrames_;
+		return !clip_ || clip_->isFinished(elapsedTime_);
 	}
 
 	sf::FloatRect Animation::getLocalBounds() const
 	{
-		return sf::FloatRect(getOrigin(), static_cast<sf::Vector2f>(getFrameSize()));
+		return sf::FloatRect(sf::Vector2f(), static_cast<sf::Vector2f>(getFrameSize()));
 	}
 
 	sf::FloatRect Animation::getGlobalBounds() const
@@ -125,50 +95,35 @@ namespace GEX
 
 	void Animation::update(sf::Time dt)
 	{
-		sf::Time timePerFrame = duration_ / static_cast<float>(numberOfFrames_);
+		// The frame is looked up in the clip when needed
 		elapsedTime_ += dt;
+	}
 
-		sf::Vector2i textureBonds(sprite_.getTexture()->getSize());
-		sf::IntRect	textureRect = sprite_.getTextureRect();
-
-		if (currentFrame_ == 0) {
-			textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
-		}
-
-		while (elapsedTime_ >= timePerFrame && (currentFrame_ <= numberOfFrames_ || repeat_))
+	void Animation::draw(sf::RenderTarget& target, sf::RenderStates states) const
+	{
+		if (isFinished())
 		{
-			// move to the next frame
-			textureRect.left += textureRect.width;
-
-			//go to the next row, if needed
-			if (textureRect.left + textureRect.width > textureBonds.x)
-			{
-				textureRect.left = 0;
-				textureRect.top += textureRect.height;
-			}
-
-			elapsedTime_ -= timePerFrame;
-
-			if (repeat_)
-			{
-				currentFrame_ = (currentFrame_ + 1) % numberOfFrames_;
-				if (currentFrame_ == 0) {
-					textureRect = sf::IntRect(0, 0, frameSize_.x, frameSize_.y);
-				}
-			}
-			else
-			{
-				currentFrame_++;
-			}
+			return;
 		}
 
-		sprite_.setTextureRect(textureRect);
-	}
+		const sf::IntRect& frame = clip_->getFrame(getCurrentFrame());
+		float width = static_cast<float>(frame.width);
+		float height = static_cast<float>(frame.height);
+		float left = static_cast<float>(frame.left);
+		float top = static_cast<float>(frame.top);
+
+		// Same quad layout as sf::Sprite
+		sf::Vertex vertices[4] =
+		{
+			sf::Vertex(sf::Vector2f(0.f, 0.f), sf::Vector2f(left, top)),
+			sf::Vertex(sf::Vector2f(0.f, height), sf::Vector2f(left, top + height)),
+			sf::Vertex(sf::Vector2f(width, 0.f), sf::Vector2f(left + width, top)),
+			sf::Vertex(sf::Vector2f(width, height), sf::Vector2f(left + width, top + height))
+		};
 
-	void Animation::draw(sf::RenderTarget& target, sf::RenderStates states) const
-	{
 		states.transform *= getTransform();
-		target.draw(sprite_, states);
+		states.texture = texture_;
+		target.draw(vertices, 4, sf::TrianglesStrip, states);
 	}
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,102 @@
+/**
+* @file
+* AnimationClip.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "AnimationClip.h"
+#include <algorithm>
+#include <cassert>
+
+namespace GEX
+{
+	AnimationClip::AnimationClip(sf::Vector2u sheetSize, sf::Vector2i frameSize, std::size_t numFrames, sf::Time duration, bool repeat)
+		: frames_()
+		, frameSize_(frameSize)
+		, duration_(duration)
+		, timePerFrame_(duration / static_cast<float>(numFrames))
+		, repeat_(repeat)
+	{
+		assert(numFrames > 0);
+
+		// Walk the sheet left to right, going to the next row when needed
+		frames_.reserve(numFrames);
+		sf::IntRect textureRect(0, 0, frameSize.x, frameSize.y);
+		for (std::size_t i = 0; i < numFrames; ++i)
+		{
+			frames_.push_back(textureRect);
+
+			textureRect.left += textureRect.width;
+			if (textureRect.left + textureRect.width > static_cast<int>(sheetSize.x))
+			{
+				textureRect.left = 0;
+				textureRect.top += textureRect.height;
+			}
+		}
+	}
+
+	const sf::IntRect & AnimationClip::getFrame(std::size_t index) const
+	{
+		return frames_[index];
+	}
+
+	std::size_t AnimationClip::getFrameIndex(sf::Time elapsedTime) const
+	{
+		std::size_t frame = static_cast<std::size_t>(elapsedTime / timePerFrame_);
+
+		if (repeat_)
+		{
+			return frame % frames_.size();
+		}
+
+		return std::min(frame, frames_.size() - 1);
+	}
+
+	std::size_t AnimationClip::getNumFrames() const
+	{
+		return frames_.size();
+	}
+
+	sf::Vector2i AnimationClip::getFrameSize() const
+	{
+		return frameSize_;
+	}
+
+	sf::Time AnimationClip::getDuration() const
+	{
+		return duration_;
+	}
+
+	bool AnimationClip::isRepeating() const
+	{
+		return repeat_;
+	}
+
+	bool AnimationClip::isFinished(sf::Time elapsedTime) const
+	{
+		return !repeat_ && elapsedTime >= duration_;
+	}
+}
@@ -0,0 +1,59 @@
+/**
+* @file
+* AnimationClip.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <vector>
+
+namespace GEX
+{
+	// Immutable description of a sprite sheet animation
+	// The frame rects are computed once and shared by every Animation playing the clip
+	class AnimationClip
+	{
+	public:
+									AnimationClip(sf::Vector2u sheetSize, sf::Vector2i frameSize, std::size_t numFrames, sf::Time duration, bool repeat);
+
+		const sf::IntRect&			getFrame(std::size_t index) const;
+		std::size_t					getFrameIndex(sf::Time elapsedTime) const; //frame to show after elapsedTime
+		std::size_t					getNumFrames() const;
+		sf::Vector2i				getFrameSize() const;
+		sf::Time					getDuration() const;
+		bool						isRepeating() const;
+		bool						isFinished(sf::Time elapsedTime) const;
+
+	private:
+		std::vector<sf::IntRect>	frames_;
+		sf::Vector2i				frameSize_;
+		sf::Time					duration_;
+		sf::Time					timePerFrame_;
+		bool						repeat_;
+	};
+}
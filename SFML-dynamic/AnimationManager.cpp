@@ -0,0 +1,64 @@
+/**
+* @file
+* AnimationManager.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "AnimationManager.h"
+#include "DataTables.h"
+
+namespace GEX
+{
+	namespace
+	{
+		const AnimationTable TABLE = initializeAnimationData();
+	}
+
+	AnimationManager* AnimationManager::instance_ = nullptr;
+
+	AnimationManager& AnimationManager::getInstance()
+	{
+		if (!instance_)
+		{
+			AnimationManager::instance_ = new AnimationManager();
+		}
+
+		return *AnimationManager::instance_;
+	}
+
+	const AnimationClip& AnimationManager::get(AnimationID id, const sf::Texture& sheet)
+	{
+		auto found = clips_.find(id);
+		if (found == clips_.end())
+		{
+			const AnimationData& data = TABLE[toIndex(id)];
+			std::unique_ptr<AnimationClip> clip(new AnimationClip(sheet.getSize(), data.frameSize, data.numFrames, data.duration, data.repeat));
+			found = clips_.insert(std::make_pair(id, std::move(clip))).first;
+		}
+
+		return *found->second;
+	}
+}
@@ -36,31 +36,71 @@
 #include "GexState.h"
 #include "GameOverState.h"
 #include "FontManager.h"
+#include "SceneNode.h"
+#include "ParticleRegistry.h"
+#include "ParticleNode.h"
+#include "ExplosionNode.h"
+#include "Aircraft.h"
+#include "SceneRoot.h"
+#include "ShaderManager.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
 
 const sf::Time Aplication::TimePerFrame = sf::seconds(1.0f / 60.0f);
+const unsigned int Aplication::MaxUpdatesPerFrame = 5;
 
-Aplication::Aplication()
+Aplication::Aplication(std::unique_ptr<GEX::AudioBackend> audio)
 	: window_(sf::VideoMode(1280, 960), "Killer Plane")
 	, player_()
 	, textures_()
-	, music_()
-	, sound_()
+	, sound_(std::move(audio))
+	, music_(sound_.getBackend())
 	, stateStack_(GEX::State::Context(window_, textures_, player_, music_, sound_))
 	, statisticsText_()
 	, statisticsUpdateTime_()
 	, statisticsNumFrames_(0)
+	, statisticsMaxFrameTime_()
+	, statisticsRenderedFrames_(0)
+	, allocationBudget_(64)
+	, statisticsAllocations_(GEX::AllocationTracker::getStats())
+	, statisticsSimulatedFrames_(0)
+	, statisticsMaxFrameAllocations_(0)
+	, statisticsFramesOverBudget_(0)
+	, statisticsUnsteadyFrame_(false)
+	, steadyFrames_(0)
+	, framesOverBudget_(0)
+	, snapshots_()
+	, writeSnapshot_(0)
+	, hasNewSnapshot_(false)
+	, isRendering_(false)
+	, isRunning_(false)
+	, snapshotMutex_()
+	, snapshotChanged_()
+	, renderThread_()
+	, bloomEffect_()
 {
 	window_.setKeyRepeatEnabled(false);
+	window_.setVerticalSyncEnabled(true);
+
+	for (std::size_t slot = 0; slot < snapshots_.size(); ++slot)
+	{
+		snapshots_[slot].setSlot(slot);
+	}
 
 	GEX::FontManager::getInstance().load(GEX::FontID::Main, "Media/Sansation.ttf");
 
+	// Every size drawn once the render thread runs: the overlay, labels and text nodes, 
+	// sf::Text's default, and the state titles
+	GEX::FontManager::getInstance().prebuildGlyphs(GEX::FontID::Main, { 12, 20, 30, 50, 70 });
+
 	textures_.load(GEX::TextureID::TitleScreen, "Media/Textures/TitleScreenBig.png");
 	textures_.load(GEX::TextureID::Face, "Media/Textures/Face.png");
 
 	statisticsText_.setFont(GEX::FontManager::getInstance().get(GEX::FontID::Main));
 	statisticsText_.setPosition(5.0f, 5.0f);
 	statisticsText_.setCharacterSize(12.0f);
-	statisticsText_.setString("Frames / Second = \nTime / Update =");
+	statisticsText_.setString("Frames / Second = \nTime / Update =\nLongest Frame =\nEmitter Binds =\nParticles =");
 
 	registerStates();
 	stateStack_.pushState(GEX::StateID::Title);
@@ -72,74 +112,323 @@ void Aplication::run()
 
 	sf::Time timeSinceLastUpdate = sf::Time::Zero;
 
-	while (window_.isOpen())
+	// The render thread owns the GL context from here on
+	isRunning_ = true;
+	window_.setActive(false);
+	renderThread_ = std::thread(&Aplication::renderLoop, this);
+
+	while (isRunning_)
 	{
 
-		timeSinceLastUpdate += clock.restart();
-		while (timeSinceLastUpdate > TimePerFrame)
+		sf::Time frameTime = clock.restart();
+		timeSinceLastUpdate += frameTime;
+		sf::Clock workClock;
+		GEX::AllocationZoneStats frameAllocations = GEX::AllocationTracker::getStats();
+		unsigned int updates = 0;
+		while (timeSinceLastUpdate > TimePerFrame && updates < MaxUpdatesPerFrame && isRunning_)
 		{
 
 			timeSinceLastUpdate -= TimePerFrame;
+			updates++;
 
 			processInputs();
 			update(TimePerFrame);
 
 			if (stateStack_.isEmpty())
 			{
-				window_.close();
+				stopRendering();
 			}
 		}
 
-		updateStatistics(timeSinceLastUpdate);
+		// Too far behind, drop the rest so a slow frame does not make the next one slower
+		if (timeSinceLastUpdate > TimePerFrame)
+		{
+			timeSinceLastUpdate %= TimePerFrame;
+		}
+
+		statisticsMaxFrameTime_ = std::max(statisticsMaxFrameTime_, frameTime);
+		updateStatistics(frameTime);
+
+		if (!isRunning_)
+		{
+			break;
+		}
+
+		// Draw in between the last two simulated states, every frame, even without a tick
+		// Publishing waits for the render thread, so its vsync paces this loop
+		GEX::SceneNode::setRenderInterpolation(timeSinceLastUpdate / TimePerFrame);
+
+		buildSnapshot(snapshots_[writeSnapshot_]);
+		GEX::ParticleRegistry::reportWorkTime(workClock.getElapsedTime(), TimePerFrame * static_cast<float>(updates));
+		publishSnapshot();
+
+		updateAllocationStatistics(frameAllocations);
+	}
+
+	renderThread_.join();
+	window_.setActive(true);
+	window_.close();
+}
+
+void Aplication::recordInput(const std::string& path)
+{
+	player_.recordSessions(path);
+}
+
+bool Aplication::replayInput(const std::string& path)
+{
+	// Checked here, before the render thread starts, a game state throwing with it running would terminate
+	try
+	{
+		player_.replaySessions(path);
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+void Aplication::setAllocationBudget(unsigned int allocationsPerFrame)
+{
+	allocationBudget_ = allocationsPerFrame;
+}
+
+bool Aplication::hasExceededAllocationBudget() const
+{
+	return framesOverBudget_ > 0;
+}
 
-		render();
+std::string Aplication::getAllocationBudgetReport() const
+{
+	if (framesOverBudget_ == 0)
+	{
+		return "";
 	}
+
+	return "Allocation budget of " + std::to_string(allocationBudget_) + " exceeded in " 
+		+ std::to_string(framesOverBudget_) + " of " + std::to_string(steadyFrames_) + " steady frames";
 }
 
 void Aplication::processInputs()
 {
+	GEX::AllocationScope scope(GEX::AllocationZone::Input);
+
 	sf::Event event;
 	while (window_.pollEvent(event))
 	{
+		player_.handleKeyState(event);
 		stateStack_.handleEvent(event);
 		if (event.type == sf::Event::Closed)
 		{
-			window_.close();
+			stopRendering();
 		}
 	}
+
+	// The last snapshot may still point at textures of a state about to be destroyed
+	if (stateStack_.hasPendingChanges())
+	{
+		waitForRenderer();
+		stateStack_.applyPendingChanges();
+		statisticsUnsteadyFrame_ = true;
+	}
 }
 
 void Aplication::update(sf::Time dt)
 {
+	GEX::AllocationScope scope(GEX::AllocationZone::Update);
+
+	GEX::SceneNode::advanceTick();
 	stateStack_.update(dt);
+	music_.update(dt);
 }
 
-void Aplication::render()
+void Aplication::buildSnapshot(GEX::RenderSnapshot& snapshot)
 {
-	window_.clear();
-	stateStack_.draw();
+	GEX::AllocationScope scope(GEX::AllocationZone::Snapshot);
+
+	snapshot.clear();
+	stateStack_.draw(snapshot);
+
+	snapshot.setView(window_.getDefaultView());
+	snapshot.draw(statisticsText_);
+}
+
+void Aplication::publishSnapshot()
+{
+	std::unique_lock<std::mutex> lock(snapshotMutex_);
+
+	// The other buffer becomes the one we record into, it must not be drawing
+	snapshotChanged_.wait(lock, [this]() { return !isRendering_; });
+
+	writeSnapshot_ = 1 - writeSnapshot_;
+	hasNewSnapshot_ = true;
+	snapshotChanged_.notify_all();
+}
+
+void Aplication::waitForRenderer()
+{
+	std::unique_lock<std::mutex> lock(snapshotMutex_);
+	snapshotChanged_.wait(lock, [this]() { return !isRendering_; });
 
-	window_.setView(window_.getDefaultView());
-	window_.draw(statisticsText_);
+	// Drop the frame not drawn yet, it was recorded from the old states
+	hasNewSnapshot_ = false;
+}
+
+void Aplication::stopRendering()
+{
+	std::lock_guard<std::mutex> lock(snapshotMutex_);
+	isRunning_ = false;
+	snapshotChanged_.notify_all();
+}
+
+void Aplication::renderLoop()
+{
+	window_.setActive(true);
+
+	while (true)
+	{
+		std::size_t readSnapshot;
+		{
+			std::unique_lock<std::mutex> lock(snapshotMutex_);
+			snapshotChanged_.wait(lock, [this]() { return hasNewSnapshot_ || !isRunning_; });
+
+			if (!isRunning_)
+			{
+				break;
+			}
+
+			readSnapshot = 1 - writeSnapshot_;
+			hasNewSnapshot_ = false;
+			isRendering_ = true;
+		}
+
+		render(snapshots_[readSnapshot]);
+		statisticsRenderedFrames_++;
+
+		{
+			std::lock_guard<std::mutex> lock(snapshotMutex_);
+			isRendering_ = false;
+		}
+		snapshotChanged_.notify_all();
+	}
+
+	window_.setActive(false);
+}
+
+void Aplication::render(const GEX::RenderSnapshot& snapshot)
+{
+	GEX::AllocationScope scope(GEX::AllocationZone::Render);
+
+	window_.clear();
+	snapshot.replay(window_, bloomEffect_);
 	window_.display();
 }
 
 void Aplication::updateStatistics(sf::Time dt)
 {
 	statisticsUpdateTime_ += dt;
-	statisticsNumFrames_++;
 
 	if (statisticsUpdateTime_ > sf::seconds(1))
 	{
+		statisticsNumFrames_ = std::max(statisticsRenderedFrames_.exchange(0), 1u);
 		statisticsText_.setString(
 			"Frames / Second = " + std::to_string(statisticsNumFrames_) + "\n" +
-			"Time / Update   = " + std::to_string(statisticsUpdateTime_.asMicroseconds() / statisticsNumFrames_) + "ms"
+			"Time / Update   = " + std::to_string(statisticsUpdateTime_.asMicroseconds() / statisticsNumFrames_) + "ms\n" +
+			"Longest Frame   = " + std::to_string(statisticsMaxFrameTime_.asMicroseconds()) + "us\n" +
+			"Emitter Binds   = " + std::to_string(GEX::ParticleRegistry::getDirectBindings()) + " direct, " 
+				+ std::to_string(GEX::ParticleRegistry::getFinderBroadcasts()) + " broadcasts\n" +
+			"Particles       = " + std::to_string(GEX::ParticleRegistry::getLiveParticles()) + " / " 
+				+ std::to_string(GEX::ParticleRegistry::getParticleBudget()) + ", LOD " + std::to_string(GEX::ParticleRegistry::getLevelOfDetail()) 
+				+ (GEX::ParticleNode::isUsingVertexBuffers() ? ", buffer\n" : ", array\n") +
+			"Entities        = " + std::to_string(GEX::Entity::getLiveEntities()) + ", explosions " 
+				+ std::to_string(GEX::ExplosionNode::getLiveExplosions()) + "\n" +
+			"Aircraft        = " + std::to_string(GEX::Aircraft::getLiveAircraft()) + " x " 
+				+ std::to_string(GEX::Aircraft::getAverageFootprint()) + " bytes\n" +
+			"Scene Nodes     = " + std::to_string(GEX::SceneRoot::getNodeCount()) + (GEX::SceneRoot::isFlatTraversal() ? " flat, " : " tree, ") 
+				+ std::to_string(GEX::SceneRoot::getRebuildCount()) + " rebuilds" 
+				+ (GEX::DebugDrawNode::isEnabled() ? ", debug draw\n" : "\n") +
+			"State Changes   = " + std::to_string(GEX::RenderSnapshot::getStateChanges()) + " sorted, " 
+				+ std::to_string(GEX::RenderSnapshot::getUnsortedStateChanges()) + " in scene order\n" +
+			"Shaders         = " + std::to_string(GEX::ShaderManager::getInstance().getCompileCount()) + " compiled\n" +
+			"Level           = " + std::to_string(GEX::World::getLevelSpawnPoints()) + " spawn points, loaded in " 
+				+ std::to_string(GEX::World::getLevelLoadTime().asMicroseconds()) + "us" +
+			getAllocationStatistics()
 		);
-		statisticsNumFrames_ = 0;
+		statisticsMaxFrameTime_ = sf::Time::Zero;
 		statisticsUpdateTime_ -= sf::seconds(1);
+
+		// Building the overlay text allocates, the frame does not count against the budget
+		statisticsUnsteadyFrame_ = true;
 	}
 }
 
+void Aplication::updateAllocationStatistics(const GEX::AllocationZoneStats& frameStart)
+{
+	if (!GEX::AllocationTracker::isEnabled())
+	{
+		return;
+	}
+
+	// Includes whatever the render thread allocated meanwhile
+	std::uint64_t allocations = GEX::AllocationTracker::getTotal(GEX::AllocationTracker::getStats()).count 
+		- GEX::AllocationTracker::getTotal(frameStart).count;
+
+	statisticsSimulatedFrames_++;
+	if (!statisticsUnsteadyFrame_)
+	{
+		steadyFrames_++;
+		statisticsMaxFrameAllocations_ = std::max(statisticsMaxFrameAllocations_, allocations);
+		if (allocations > allocationBudget_)
+		{
+			statisticsFramesOverBudget_++;
+			framesOverBudget_++;
+		}
+	}
+	statisticsUnsteadyFrame_ = false;
+}
+
+std::string Aplication::getAllocationStatistics()
+{
+	if (!GEX::AllocationTracker::isEnabled())
+	{
+		return "";
+	}
+
+	// Per frame averages of the last second, by zone
+	GEX::AllocationZoneStats current = GEX::AllocationTracker::getStats();
+	unsigned int frames = std::max(statisticsSimulatedFrames_, 1u);
+
+	std::string zones;
+	for (std::size_t i = 0; i < current.size(); ++i)
+	{
+		std::uint64_t count = current[i].count - statisticsAllocations_[i].count;
+		if (count > 0)
+		{
+			zones += std::string(zones.empty() ? "" : ", ") 
+				+ GEX::AllocationTracker::getZoneName(static_cast<GEX::AllocationZone>(i)) + " " + std::to_string(count / frames);
+		}
+	}
+
+	GEX::AllocationStats total = GEX::AllocationTracker::getTotal(current);
+	GEX::AllocationStats previous = GEX::AllocationTracker::getTotal(statisticsAllocations_);
+
+	std::string text =
+		"\nAllocs / Frame  = " + std::to_string((total.count - previous.count) / frames) + 
+		" (" + std::to_string((total.bytes - previous.bytes) / frames) + " bytes)\n" +
+		"  " + zones + "\n" +
+		"Most Allocs     = " + std::to_string(statisticsMaxFrameAllocations_) + 
+		", " + std::to_string(statisticsFramesOverBudget_) + " frames over " + std::to_string(allocationBudget_);
+
+	statisticsAllocations_ = current;
+	statisticsSimulatedFrames_ = 0;
+	statisticsMaxFrameAllocations_ = 0;
+	statisticsFramesOverBudget_ = 0;
+
+	return text;
+}
+
 void Aplication::registerStates()
 {
 	stateStack_.registerState<TitleState>(GEX::StateID::Title);
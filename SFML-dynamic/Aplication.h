@@ -39,33 +39,86 @@
 #include "StateStack.h"
 #include "MusicPlayer.h"
 #include "SoundPlayer.h"
+#include "RenderSnapshot.h"
+#include "BloomEffect.h"
+#include "AllocationTracker.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 class Aplication
 {
 public:
-	Aplication();
+	explicit				Aplication(std::unique_ptr<GEX::AudioBackend> audio);	//see createAudioBackend
 		
 	void					run();
 
+	// Record or replay the input of every game played, see InputRecording
+	void					recordInput(const std::string& path);
+	bool					replayInput(const std::string& path);	//false if the file can not be replayed
+
+	// Steady frames allocating more than this are reported, when allocations are tracked
+	void					setAllocationBudget(unsigned int allocationsPerFrame);
+	bool					hasExceededAllocationBudget() const;
+	std::string				getAllocationBudgetReport() const;	//empty when within the budget
+
 private:
 	void					processInputs();
 	void					update(sf::Time dt);
-	void					render();
+	void					buildSnapshot(GEX::RenderSnapshot& snapshot);
 	void					updateStatistics(sf::Time dt);
+	void					updateAllocationStatistics(const GEX::AllocationZoneStats& frameStart);
+	std::string				getAllocationStatistics();
 	void					registerStates();
 
+	// Simulation side of the snapshot exchange
+	void					publishSnapshot();
+	void					waitForRenderer();
+	void					stopRendering();
+
+	// Render thread
+	void					renderLoop();
+	void					render(const GEX::RenderSnapshot& snapshot);
+
 private:
 	static const sf::Time	TimePerFrame;
+	static const unsigned int	MaxUpdatesPerFrame; //above this the game slows down instead of catching up
 
 	sf::RenderWindow		window_;
 	GEX::PlayerControl		player_;
 	GEX::TextureManager		textures_;
 	GEX::StateStack			stateStack_;
-	GEX::MusicPlayer		music_;
-	GEX::SoundPlayer		sound_;
+	GEX::SoundPlayer		sound_;		//owns the audio backend
+	GEX::MusicPlayer		music_;		//streams through it
 
 	sf::Text				statisticsText_;
 	sf::Time				statisticsUpdateTime_;
 	unsigned int			statisticsNumFrames_;
+	sf::Time				statisticsMaxFrameTime_;
+	std::atomic<unsigned int>	statisticsRenderedFrames_;	//counted by the render thread
+
+	unsigned int			allocationBudget_;
+	GEX::AllocationZoneStats	statisticsAllocations_;			//totals when the statistics were last shown
+	unsigned int			statisticsSimulatedFrames_;
+	std::uint64_t			statisticsMaxFrameAllocations_;
+	unsigned int			statisticsFramesOverBudget_;
+	bool					statisticsUnsteadyFrame_;		//the frame loaded or unloaded a state or refreshed the overlay
+	unsigned int			steadyFrames_;					//since the start
+	unsigned int			framesOverBudget_;
+
+	// Double buffered snapshots, the simulation records one while the other is drawn
+	std::array<GEX::RenderSnapshot, GEX::RenderSnapshot::SlotCount>	snapshots_;
+	std::size_t				writeSnapshot_;		//the one the simulation records into
+	bool					hasNewSnapshot_;	//the other one has not been drawn yet
+	bool					isRendering_;
+	bool					isRunning_;
+	std::mutex				snapshotMutex_;
+	std::condition_variable	snapshotChanged_;
+	std::thread				renderThread_;
+
+	// Only touched by the render thread
+	GEX::BloomEffect		bloomEffect_;
 };
 
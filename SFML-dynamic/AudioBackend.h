@@ -0,0 +1,76 @@
+/**
+* @file
+* AudioBackend.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector3.hpp>
+#include "ResourceIdentifier.h"
+#include <memory>
+#include <string>
+
+namespace GEX
+{
+	// One background music stream, MusicPlayer crossfades between two of them
+	class MusicStream : sf::NonCopyable
+	{
+	public:
+		virtual					~MusicStream() = default;
+
+		virtual bool			openFromFile(const std::string& path) = 0;	//called from a loading thread
+		virtual void			play() = 0;
+		virtual void			pause() = 0;
+		virtual void			stop() = 0;
+		virtual void			setVolume(float volume) = 0;
+		virtual void			setLoop(bool loop) = 0;
+		virtual bool			isPlaying() const = 0;
+	};
+
+	// Where the sound effects and the music end up being played
+	// SoundPlayer works in 3D sound coordinates and forwards everything here
+	class AudioBackend : sf::NonCopyable
+	{
+	public:
+		virtual					~AudioBackend() = default;
+
+		virtual void			loadBuffer(SoundEffectID id, const std::string& path) = 0;
+		virtual void			play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume) = 0;
+		virtual void			removeStoppedSounds() = 0;
+
+		virtual void			setListenerPosition(sf::Vector3f position) = 0;
+		virtual sf::Vector3f	getListenerPosition() const = 0;
+
+		virtual std::size_t		getVoiceCount() const = 0; //sounds currently playing
+
+		virtual std::unique_ptr<MusicStream>	createMusicStream() = 0;
+	};
+
+	// "openal" plays on the audio device, "null" plays nothing and "offline" mixes the effects in memory
+	// Returns nullptr for any other name
+	std::unique_ptr<AudioBackend>	createAudioBackend(const std::string& name);
+}
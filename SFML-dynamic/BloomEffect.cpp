@@ -28,95 +28,58 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 #include "BloomEffect.h"
-
-#include <string>
-#include <cassert>
+#include "ShaderManager.h"
+#include "RenderTexturePool.h"
 #include <SFML/Graphics/Shader.hpp>
 
 namespace GEX
 {
 	BloomEffect::BloomEffect()
-		: shaders_()
-		, brightnessTexture_()
-		, firstPassTexture_()
-		, secondPassTexture_()
 	{
-
-
-		std::unique_ptr<sf::Shader> s(new sf::Shader()); 
-		std::string f1name = "Media/Shaders/Fullpass.vert";
-		std::string f2name = "Media/Shaders/Brightness.frag";
-		if (!(s->loadFromFile("Media/Shaders/Fullpass.vert", "Media/Shaders/Brightness.frag")))
-			throw std::runtime_error("Shader::load - Failed to load ");
-		auto inserted = shaders_.insert(std::make_pair(Shaders::BrightnessPass, std::move(s)));
-		assert(inserted.second);
-
-		s.reset(new sf::Shader());
-		f1name = "Media/Shaders/Fullpass.vert";
-		f2name = "Media/Shaders/DownSample.frag";
-		if (!s->loadFromFile(f1name, f2name))
-			throw std::runtime_error("Shader::load - Failed to load " + f1name);
-		inserted = shaders_.insert(std::make_pair(Shaders::DownSamplePass, std::move(s)));
-		assert(inserted.second);
-
-		s.reset(new sf::Shader());
-		f1name = "Media/Shaders/Fullpass.vert";
-		f2name = "Media/Shaders/GuassianBlur.frag";
-		if (!s->loadFromFile(f1name, f2name))
-			throw std::runtime_error("Shader::load - Failed to load " + f1name);
-		inserted = shaders_.insert(std::make_pair(Shaders::GaussianBlurPass, std::move(s)));
-		assert(inserted.second);
-
-		s.reset(new sf::Shader());
-		f1name = "Media/Shaders/Fullpass.vert";
-		f2name = "Media/Shaders/Add.frag";
-		if (!s->loadFromFile(f1name, f2name))
-			throw std::runtime_error("Shader::load - Failed to load " + f1name);
-		inserted = shaders_.insert(std::make_pair(Shaders::AddPass, std::move(s)));
-		assert(inserted.second);
-
+		// Compiled now, so a missing file fails at start up and not on the render thread
+		ShaderManager& shaders = ShaderManager::getInstance();
+		shaders.get(ShaderID::BrightnessPass);
+		shaders.get(ShaderID::DownSamplePass);
+		shaders.get(ShaderID::GaussianBlurPass);
+		shaders.get(ShaderID::AddPass);
 	}
 
 	void BloomEffect::apply(const sf::RenderTexture& input, sf::RenderTarget& output)
 	{
-		prepareTextures(input.getSize());
+		RenderTexturePool& pool = RenderTexturePool::getInstance();
+		sf::Vector2u size = input.getSize();
 
-		filterBright(input, brightnessTexture_);
+		sf::RenderTexture& brightnessTexture = pool.borrow(size, true);
+		RenderTextureArray firstPassTexture = { &pool.borrow(size / 2u, true), &pool.borrow(size / 2u, true) };
+		RenderTextureArray secondPassTexture = { &pool.borrow(size / 4u, true), &pool.borrow(size / 4u, true) };
 
-		downSample(brightnessTexture_, firstPassTexture_[0]);
-		blurMultipass(firstPassTexture_);
+		filterBright(input, brightnessTexture);
 
-		downSample(firstPassTexture_[0], secondPassTexture_[0]);
-		blurMultipass(secondPassTexture_);
+		downSample(brightnessTexture, *firstPassTexture[0]);
+		blurMultipass(firstPassTexture);
 
-		add(firstPassTexture_[0], secondPassTexture_[0], firstPassTexture_[1]);
-		firstPassTexture_[1].display();
+		downSample(*firstPassTexture[0], *secondPassTexture[0]);
+		blurMultipass(secondPassTexture);
 
-		add(input, firstPassTexture_[1], output);
-	}
+		add(*firstPassTexture[0], *secondPassTexture[0], *firstPassTexture[1]);
+		firstPassTexture[1]->display();
 
-	void BloomEffect::prepareTextures(sf::Vector2u size)
-	{
-		if (brightnessTexture_.getSize() != size)
+		add(input, *firstPassTexture[1], output);
+
+		pool.giveBack(brightnessTexture);
+		for (sf::RenderTexture* texture : firstPassTexture)
+		{
+			pool.giveBack(*texture);
+		}
+		for (sf::RenderTexture* texture : secondPassTexture)
 		{
-			brightnessTexture_.create(size.x, size.y);
-			brightnessTexture_.setSmooth(true);
-
-			firstPassTexture_[0].create(size.x / 2, size.y / 2);
-			firstPassTexture_[0].setSmooth(true);
-			firstPassTexture_[1].create(size.x / 2, size.y / 2);
-			firstPassTexture_[1].setSmooth(true);
-
-			secondPassTexture_[0].create(size.x / 4, size.y / 4);
-			secondPassTexture_[0].setSmooth(true);
-			secondPassTexture_[1].create(size.x / 4, size.y / 4);
-			secondPassTexture_[1].setSmooth(true);
+			pool.giveBack(*texture);
 		}
 	}
 
 	void BloomEffect::filterBright(const sf::RenderTexture& input, sf::RenderTexture& output)
 	{
-		sf::Shader& brightness = *shaders_.at(Shaders::BrightnessPass);
+		sf::Shader& brightness = ShaderManager::getInstance().get(ShaderID::BrightnessPass);
 
 		brightness.setUniform("source", input.getTexture());
 		applyShader(brightness, output);
@@ -125,18 +88,18 @@ namespace GEX
 
 	void BloomEffect::blurMultipass(RenderTextureArray& renderTextures)
 	{
-		sf::Vector2u textureSize = renderTextures[0].getSize();
+		sf::Vector2u textureSize = renderTextures[0]->getSize();
 
 		for (std::size_t count = 0; count < 2; ++count)
 		{
-			blur(renderTextures[0], renderTextures[1], sf::Vector2f(0.f, 1.f / textureSize.y));
-			blur(renderTextures[1], renderTextures[0], sf::Vector2f(1.f / textureSize.x, 0.f));
+			blur(*renderTextures[0], *renderTextures[1], sf::Vector2f(0.f, 1.f / textureSize.y));
+			blur(*renderTextures[1], *renderTextures[0], sf::Vector2f(1.f / textureSize.x, 0.f));
 		}
 	}
 
 	void BloomEffect::blur(const sf::RenderTexture& input, sf::RenderTexture& output, sf::Vector2f offsetFactor)
 	{
-		sf::Shader& gaussianBlur = *shaders_.at(Shaders::GaussianBlurPass);
+		sf::Shader& gaussianBlur = ShaderManager::getInstance().get(ShaderID::GaussianBlurPass);
 
 		gaussianBlur.setUniform("source", input.getTexture());
 		gaussianBlur.setUniform("offsetFactor", offsetFactor);
@@ -146,7 +109,7 @@ namespace GEX
 
 	void BloomEffect::downSample(const sf::RenderTexture& input, sf::RenderTexture& output)
 	{
-		sf::Shader& downSampler = *shaders_.at(Shaders::DownSamplePass);
+		sf::Shader& downSampler = ShaderManager::getInstance().get(ShaderID::DownSamplePass);
 
 		downSampler.setUniform("source", input.getTexture());
 		downSampler.setUniform("sourceSize", sf::Vector2f(input.getSize()));
@@ -156,7 +119,7 @@ namespace GEX
 
 	void BloomEffect::add(const sf::RenderTexture& source, const sf::RenderTexture& bloom, sf::RenderTarget& output)
 	{
-		sf::Shader& adder = *shaders_.at(Shaders::AddPass);
+		sf::Shader& adder = ShaderManager::getInstance().get(ShaderID::AddPass);
 
 		adder.setUniform("source", source.getTexture());
 		adder.setUniform("bloom", bloom.getTexture());
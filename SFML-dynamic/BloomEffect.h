@@ -30,25 +30,16 @@
 #pragma once
 #include "PostEffect.h"
 #include <array>
-#include <map>
-#include <memory>
 #include <SFML/Graphics/RenderTexture.hpp>
 
 namespace GEX
 {
+	// Shaders come from the ShaderManager and textures are borrowed from the RenderTexturePool,
+	// so building another effect compiles nothing and allocates no framebuffer
 	class BloomEffect : public PostEffect
 	{
-	public:
-		enum class Shaders
-		{
-			BrightnessPass,
-			DownSamplePass,
-			GaussianBlurPass,
-			AddPass,
-		};
-
 	private:
-		typedef std::array<sf::RenderTexture, 2> RenderTextureArray;
+		typedef std::array<sf::RenderTexture*, 2> RenderTextureArray;
 
 	public:
 		BloomEffect();
@@ -56,18 +47,10 @@ namespace GEX
 		void											apply(const sf::RenderTexture& input, sf::RenderTarget& output) override;
 
 	private:
-		void											prepareTextures(sf::Vector2u size);
 		void											filterBright(const sf::RenderTexture& input, sf::RenderTexture& output);
 		void											blurMultipass(RenderTextureArray& renderTextures);
 		void											blur(const sf::RenderTexture& input, sf::RenderTexture& output, sf::Vector2f offsetFactor);
 		void											downSample(const sf::RenderTexture& input, sf::RenderTexture& output);
 		void											add(const sf::RenderTexture& source, const sf::RenderTexture& bloom, sf::RenderTarget& target);
-
-	private:
-		std::map<Shaders, std::unique_ptr<sf::Shader>>	shaders_;
-
-		sf::RenderTexture								brightnessTexture_;
-		RenderTextureArray								firstPassTexture_;
-		RenderTextureArray								secondPassTexture_;
 	};
 }
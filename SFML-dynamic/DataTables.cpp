@@ -31,102 +31,95 @@
 
 namespace GEX
 {
-	std::map<AircraftType, AircraftData> initializeAircraftData()
+	AircraftTable& getAircraftTable()
 	{
-		std::map<AircraftType, AircraftData> data;
-		//Eagle
-		data[AircraftType::Eagle].hitpoints = 100;
-		data[AircraftType::Eagle].speed = 200.f;
-		data[AircraftType::Eagle].texture = TextureID::Entities;
-		data[AircraftType::Eagle].textureRect = sf::IntRect(0, 0, 48, 64);
-		data[AircraftType::Eagle].fireInterval = sf::seconds(1);
-		data[AircraftType::Eagle].missileAmount = 12;
-		data[AircraftType::Eagle].hasRollAnimation = true;
-
-		//Raptor
-		data[AircraftType::Raptor].hitpoints = 20;
-		data[AircraftType::Raptor].speed = 80.f;
-		data[AircraftType::Raptor].texture = TextureID::Entities;
-		data[AircraftType::Raptor].textureRect = sf::IntRect(144, 0, 84, 64);
-		data[AircraftType::Raptor].directions.emplace_back(Direction(45.f, 80.f)); //Emplace back avooid create a temp object - saves resources
-		data[AircraftType::Raptor].directions.emplace_back(Direction(-45.f, 160.f));
-		data[AircraftType::Raptor].directions.emplace_back(Direction(45.f, 80.f));
-		data[AircraftType::Raptor].fireInterval = sf::Time::Zero;
-		data[AircraftType::Raptor].missileAmount = 0;
-		data[AircraftType::Raptor].hasRollAnimation = false;
-
-		//Avenger
-		data[AircraftType::Avenger].hitpoints = 40;
-		data[AircraftType::Avenger].speed = 50.f;
-		data[AircraftType::Avenger].texture = TextureID::Entities;
-		data[AircraftType::Avenger].textureRect = sf::IntRect(228, 0, 60, 59);
-		data[AircraftType::Avenger].directions.emplace_back(Direction(45.f, 50.f)); //Emplace back avooid create a temp object - saves resources
-		data[AircraftType::Avenger].directions.emplace_back(Direction(0.f, 50.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(-45.f, 100.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(0.f, 50.f));
-		data[AircraftType::Avenger].directions.emplace_back(Direction(45.f, 50.f));
-		data[AircraftType::Avenger].fireInterval = sf::seconds(4);
-		data[AircraftType::Avenger].missileAmount = 0;
-		data[AircraftType::Avenger].hasRollAnimation = false;
-
-		return data;
+		static AircraftTable table = initializeAircraftData();
+		return table;
 	}
 
-	std::map<Projectile::Type, ProjectileData> initializeProjectileData()
+	ProjectileTable& getProjectileTable()
 	{
-		std::map<Projectile::Type, ProjectileData> data;
-
-		data[Projectile::Type::AlliedBullet].damage = 10;
-		data[Projectile::Type::AlliedBullet].speed = 500.f;
-		data[Projectile::Type::AlliedBullet].texture = TextureID::Entities;
-		data[Projectile::Type::AlliedBullet].textureRect = sf::IntRect(175, 64, 3, 14);
-
-		data[Projectile::Type::EnemyBullet].damage = 10;
-		data[Projectile::Type::EnemyBullet].speed = 500.f;
-		data[Projectile::Type::EnemyBullet].texture = TextureID::Entities;
-		data[Projectile::Type::EnemyBullet].textureRect = sf::IntRect(178, 64, 3, 14);
+		static ProjectileTable table = initializeProjectileData();
+		return table;
+	}
 
-		data[Projectile::Type::Missile].damage = 200;
-		data[Projectile::Type::Missile].speed = 250.f;
-		data[Projectile::Type::Missile].texture = TextureID::Entities;
-		data[Projectile::Type::Missile].textureRect = sf::IntRect(160, 64, 15, 24);
+	// Entries must follow the order of the type enums
 
-		return data;
+	AircraftTable initializeAircraftData()
+	{
+		const AircraftData data[] =
+		{
+			// hitpoints, speed, texture, textureRect, fireInterval, missileAmount, hasRollAnimation, directions
+			// Eagle
+			{ 100, 200.f, TextureID::Entities, sf::IntRect(0, 0, 48, 64), sf::seconds(1), 12, true, {} },
+			// Raptor
+			{ 20, 80.f, TextureID::Entities, sf::IntRect(144, 0, 84, 64), sf::Time::Zero, 0, false,
+				{ Direction(45.f, 80.f), Direction(-45.f, 160.f), Direction(45.f, 80.f) } },
+			// Avenger
+			{ 40, 50.f, TextureID::Entities, sf::IntRect(228, 0, 60, 59), sf::seconds(4), 0, false,
+				{ Direction(45.f, 50.f), Direction(0.f, 50.f), Direction(-45.f, 100.f), Direction(0.f, 50.f), Direction(45.f, 50.f) } },
+		};
+
+		return makeTable<AircraftTable>(data);
 	}
 
-	std::map<Pickup::Type, PickupData> initializePickupData()
+	ProjectileTable initializeProjectileData()
 	{
-		std::map<Pickup::Type, PickupData> data;
-
-		data[Pickup::Type::HealthRefill].texture = TextureID::Entities;
-		data[Pickup::Type::HealthRefill].textureRect = sf::IntRect(0, 64, 40, 40);
-		data[Pickup::Type::HealthRefill].action = [](Aircraft& a) {a.repair(25); };
-
-		data[Pickup::Type::MissileRefill].texture = TextureID::Entities;
-		data[Pickup::Type::MissileRefill].textureRect = sf::IntRect(40, 64, 40, 40);
-		data[Pickup::Type::MissileRefill].action = [](Aircraft& a) {a.collectMissiles(3); };
-
-		data[Pickup::Type::FireSpread].texture = TextureID::Entities;
-		data[Pickup::Type::FireSpread].textureRect = sf::IntRect(80, 64, 40, 40);
-		data[Pickup::Type::FireSpread].action = [](Aircraft& a) {a.increaseFireSpread(); };
-
-		data[Pickup::Type::FireRate].texture = TextureID::Entities;
-		data[Pickup::Type::FireRate].textureRect = sf::IntRect(120, 64, 40, 40);
-		data[Pickup::Type::FireRate].action = [](Aircraft& a) {a.increaseFireRate(); };
-
-		return data;
+		const ProjectileData data[] =
+		{
+			// damage, speed, texture, textureRect
+			// AlliedBullet
+			{ 10, 500.f, TextureID::Entities, sf::IntRect(175, 64, 3, 14) },
+			// EnemyBullet
+			{ 10, 500.f, TextureID::Entities, sf::IntRect(178, 64, 3, 14) },
+			// Missile
+			{ 200, 250.f, TextureID::Entities, sf::IntRect(160, 64, 15, 24) },
+		};
+
+		return makeTable<ProjectileTable>(data);
 	}
 
-	std::map<Particle::Type, ParticleData> initializeParticleData()
+	PickupTable initializePickupData()
 	{
-		std::map<Particle::Type, ParticleData> data;
-
-		data[Particle::Type::Propellant].color = sf::Color(255, 255, 50);
-		data[Particle::Type::Propellant].lifetime = sf::seconds(0.6f);
+		const PickupData data[] =
+		{
+			// action, texture, textureRect
+			// HealthRefill
+			{ [](Aircraft& a) {a.repair(25); }, TextureID::Entities, sf::IntRect(0, 64, 40, 40) },
+			// MissileRefill
+			{ [](Aircraft& a) {a.collectMissiles(3); }, TextureID::Entities, sf::IntRect(40, 64, 40, 40) },
+			// FireSpread
+			{ [](Aircraft& a) {a.increaseFireSpread(); }, TextureID::Entities, sf::IntRect(80, 64, 40, 40) },
+			// FireRate
+			{ [](Aircraft& a) {a.increaseFireRate(); }, TextureID::Entities, sf::IntRect(120, 64, 40, 40) },
+		};
+
+		return makeTable<PickupTable>(data);
+	}
 
-		data[Particle::Type::Smoke].color = sf::Color(50, 50, 50);
-		data[Particle::Type::Smoke].lifetime = sf::seconds(3.f);
+	ParticleTable initializeParticleData()
+	{
+		const ParticleData data[] =
+		{
+			// color, lifetime, emissionRate, maxParticles
+			// Propellant
+			{ sf::Color(255, 255, 50), sf::seconds(0.6f), 30.f, 2000 },
+			// Smoke
+			{ sf::Color(50, 50, 50), sf::seconds(3.f), 30.f, 6000 },
+		};
+
+		return makeTable<ParticleTable>(data);
+	}
 
-		return data;
+	AnimationTable initializeAnimationData()
+	{
+		const AnimationData data[] =
+		{
+			// frameSize, numFrames, duration, repeat
+			// Explosion
+			{ sf::Vector2i(256, 256), 16, sf::seconds(1), false },
+		};
+
+		return makeTable<AnimationTable>(data);
 	}
 }
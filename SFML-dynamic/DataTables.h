@@ -30,7 +30,8 @@
 #pragma once
 #include "TextureManager.h"
 #include "Aircraft.h"
-#include <map>
+#include <array>
+#include <algorithm>
 #include "Projectile.h"
 #include "Pickup.h"
 #include "Particle.h"
@@ -80,10 +81,50 @@ namespace GEX
 	{
 		sf::Color								color;
 		sf::Time								lifetime;
+		float									emissionRate;	//particles per second and emitter
+		std::size_t								maxParticles;	//live at once in the system
 	};
 
-	std::map<AircraftType, AircraftData>		initializeAircraftData();
-	std::map<Projectile::Type, ProjectileData>	initializeProjectileData();
-	std::map<Pickup::Type, PickupData>			initializePickupData();
-	std::map<Particle::Type, ParticleData>		initializeParticleData();
+	struct AnimationData
+	{
+		sf::Vector2i							frameSize;
+		std::size_t								numFrames;
+		sf::Time								duration;
+		bool									repeat;
+	};
+
+	// Tables are indexed by the type enum, one entry per enumerator
+	template <typename Type>
+	constexpr std::size_t toIndex(Type type)
+	{
+		return static_cast<std::size_t>(type);
+	}
+
+	using AircraftTable		= std::array<AircraftData,		toIndex(AircraftType::Count)>;
+	using ProjectileTable	= std::array<ProjectileData,	toIndex(Projectile::Type::Count)>;
+	using PickupTable		= std::array<PickupData,		toIndex(Pickup::Type::Count)>;
+	using ParticleTable		= std::array<ParticleData,		toIndex(Particle::Type::ParticleCount)>;
+	using AnimationTable	= std::array<AnimationData,		toIndex(AnimationID::Count)>;
+
+	// Copy the entries to the table, failing to compile if a type is missing an entry
+	template <typename Table, typename Data, std::size_t N>
+	Table makeTable(const Data(&entries)[N])
+	{
+		static_assert(N == std::tuple_size<Table>::value, "Data table needs exactly one entry per type");
+
+		Table table;
+		std::copy(entries, entries + N, table.begin());
+		return table;
+	}
+
+	// Tables shared by the game objects, filled with the defaults below
+	// The level file can override them at mission start
+	AircraftTable&								getAircraftTable();
+	ProjectileTable&							getProjectileTable();
+
+	AircraftTable								initializeAircraftData();
+	ProjectileTable								initializeProjectileData();
+	PickupTable									initializePickupData();
+	ParticleTable								initializeParticleData();
+	AnimationTable								initializeAnimationData();
 }
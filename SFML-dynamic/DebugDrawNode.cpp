@@ -0,0 +1,94 @@
+/**
+* @file
+* DebugDrawNode.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "DebugDrawNode.h"
+
+namespace GEX
+{
+	bool DebugDrawNode::isEnabled_ = false;
+
+	DebugDrawNode::DebugDrawNode()
+		: SceneNode()
+		, vertexArray_(sf::Lines)
+		, drawnArrays_()
+	{
+	}
+
+	void DebugDrawNode::addLine(sf::Vector2f from, sf::Vector2f to, sf::Color color) const
+	{
+		vertexArray_.append(sf::Vertex(from, color));
+		vertexArray_.append(sf::Vertex(to, color));
+	}
+
+	void DebugDrawNode::addRect(const sf::FloatRect& rect, sf::Color color) const
+	{
+		// Nodes without a bounding box give an empty one
+		if (rect.width == 0.f && rect.height == 0.f)
+		{
+			return;
+		}
+
+		sf::Vector2f topLeft(rect.left, rect.top);
+		sf::Vector2f topRight(rect.left + rect.width, rect.top);
+		sf::Vector2f bottomRight(rect.left + rect.width, rect.top + rect.height);
+		sf::Vector2f bottomLeft(rect.left, rect.top + rect.height);
+
+		addLine(topLeft, topRight, color);
+		addLine(topRight, bottomRight, color);
+		addLine(bottomRight, bottomLeft, color);
+		addLine(bottomLeft, topLeft, color);
+	}
+
+	void DebugDrawNode::setEnabled(bool enabled)
+	{
+		isEnabled_ = enabled;
+	}
+
+	bool DebugDrawNode::isEnabled()
+	{
+		return isEnabled_;
+	}
+
+	void DebugDrawNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
+	{
+		if (vertexArray_.getVertexCount() == 0)
+		{
+			return;
+		}
+
+		// Swapped like the labels of LabelBatchNode, nothing is copied
+		sf::VertexArray& drawn = drawnArrays_[target.getSlot()];
+		std::swap(drawn, vertexArray_);
+		target.drawStored(drawn, states);
+
+		// Shapes are added again on the next draw
+		vertexArray_.clear();
+		vertexArray_.setPrimitiveType(sf::Lines);
+	}
+}
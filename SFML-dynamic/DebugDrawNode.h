@@ -0,0 +1,60 @@
+/**
+* @file
+* DebugDrawNode.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "SceneNode.h"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <array>
+
+namespace GEX
+{
+	// Lines and rectangle outlines added during the draw traversal, drawn in a single draw call
+	// Must be drawn after the nodes that add shapes. Off by default, nothing is gathered while off
+	class DebugDrawNode : public SceneNode
+	{
+	public:
+								DebugDrawNode();
+
+		// world coordinates
+		void					addLine(sf::Vector2f from, sf::Vector2f to, sf::Color color) const;
+		void					addRect(const sf::FloatRect& rect, sf::Color color) const;
+
+		static void				setEnabled(bool enabled);
+		static bool				isEnabled();
+
+	private:
+		void					drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
+
+	private:
+		mutable sf::VertexArray	vertexArray_;	//shapes added this draw
+		mutable std::array<sf::VertexArray, RenderSnapshot::SlotCount>	drawnArrays_;	//recorded by each snapshot
+
+		static bool				isEnabled_;
+	};
+}
@@ -30,16 +30,27 @@
 #include "EmitterNode.h"
 #include "CommandQueue.h"
 #include "Command.h"
+#include "ParticleRegistry.h"
+#include "RecycledMemory.h"
 
 namespace GEX
 {
-
-	EmitterNode::EmitterNode(Particle::Type type)
+	EmitterNode::EmitterNode(Particle::Type type, ParticleNode* particleSystem)
 		: SceneNode()
 		, type_(type)
 		, accumulateTime_(sf::Time::Zero)
-		, particleSystem_(nullptr)
+		, particleSystem_(particleSystem)
+	{
+	}
+
+	void* EmitterNode::operator new(std::size_t size)
 	{
+		return RecycledMemory<EmitterNode>::allocate(size);
+	}
+
+	void EmitterNode::operator delete(void* memory, std::size_t size)
+	{
+		RecycledMemory<EmitterNode>::release(memory, size);
 	}
 
 	void EmitterNode::updateCurrent(sf::Time dt, CommandQueue & commands)
@@ -63,20 +74,29 @@ namespace GEX
 			command.action = derivedAction<ParticleNode>(finder);
 
 			commands.push(command);
+			ParticleRegistry::countFinderBroadcast();
 		}
 	}
 
 	void EmitterNode::emitParticle(sf::Time dt)
 	{
-		const float EMISSION_RATE = 30.f;
-		const sf::Time interval = sf::seconds(1.f) / EMISSION_RATE;
+		sf::Vector2f position = getWorldPosition();
+
+		float emissionRate = particleSystem_->getEmissionRate(position);
+		if (emissionRate <= 0.f)
+		{
+			accumulateTime_ = sf::Time::Zero;
+			return;
+		}
+
+		const sf::Time interval = sf::seconds(1.f) / emissionRate;
 
 		accumulateTime_ += dt;
 
 		while (accumulateTime_ > interval)
 		{
 			accumulateTime_ -= interval;
-			particleSystem_->addParticle(getWorldPosition());
+			particleSystem_->addParticle(position);
 		}
 
 	}
@@ -37,7 +37,11 @@ namespace GEX
 	class EmitterNode : public SceneNode
 	{
 	public:
-		explicit		EmitterNode(Particle::Type type);
+		explicit		EmitterNode(Particle::Type type, ParticleNode* particleSystem = nullptr); //without a system it is searched for
+
+		// Emitters come and go with every missile, their memory is reused
+		static void*	operator new(std::size_t size);
+		static void		operator delete(void* memory, std::size_t size);
 
 	private:
 		void			updateCurrent(sf::Time dt, CommandQueue& commands) override;
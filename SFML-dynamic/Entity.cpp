@@ -32,11 +32,19 @@
 
 namespace GEX
 {
+	std::size_t Entity::liveEntities_ = 0;
+
 	Entity::Entity(int points)
 		: hitpoints_(points)
 	{
+		++liveEntities_;
+	}
 
+	Entity::~Entity()
+	{
+		--liveEntities_;
 	}
+
 	void Entity::setVelocity(sf::Vector2f velocity)
 	{
 		velocity_ = velocity;
@@ -96,6 +104,11 @@ namespace GEX
 		destroy();
 	}
 
+	std::size_t Entity::getLiveEntities()
+	{
+		return liveEntities_;
+	}
+
 	void Entity::updateCurrent(sf::Time dt, CommandQueue& Commands)
 	{
 		move(velocity_ * dt.asSeconds());
@@ -40,6 +40,7 @@ namespace GEX
 	public:
 
 		explicit		Entity(int points);
+		virtual			~Entity();
 
 		void			setVelocity(sf::Vector2f velocity);
 		void			setVelocity(float vx, float vy);
@@ -56,6 +57,9 @@ namespace GEX
 		bool			isDestroyed() const override;
 		virtual void	remove();
 
+		// For the stats overlay
+		static std::size_t	getLiveEntities();
+
 	protected:
 		virtual void	updateCurrent(sf::Time dt, CommandQueue& Commands) override;
 
@@ -63,6 +67,8 @@ namespace GEX
 		sf::Vector2f	velocity_;
 		int				hitpoints_;
 
+		static std::size_t	liveEntities_;
+
 	};
 }
 
@@ -0,0 +1,128 @@
+/**
+* @file
+* ExplosionNode.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "ExplosionNode.h"
+#include "AnimationManager.h"
+#include "RenderSnapshot.h"
+#include <algorithm>
+
+namespace GEX
+{
+	const std::size_t ExplosionNode::PoolSize = 64;
+
+	std::size_t ExplosionNode::liveExplosions_ = 0;
+
+	ExplosionNode::ExplosionNode(const TextureManager& textures)
+		: SceneNode()
+		, texture_(textures.get(TextureID::Explosion))
+		, clip_(AnimationManager::getInstance().get(AnimationID::Explosion, textures.get(TextureID::Explosion)))
+		, explosions_()
+		, vertexArrays_()
+	{
+		explosions_.reserve(PoolSize);
+	}
+
+	void ExplosionNode::add(sf::Vector2f position)
+	{
+		if (explosions_.size() < PoolSize)
+		{
+			explosions_.push_back({ position, sf::Time::Zero });
+			return;
+		}
+
+		// Recycle the slot of the explosion closest to its end
+		auto oldest = std::max_element(explosions_.begin(), explosions_.end(), 
+			[](const Explosion& a, const Explosion& b) { return a.elapsedTime < b.elapsedTime; });
+		*oldest = { position, sf::Time::Zero };
+	}
+
+	std::size_t ExplosionNode::getLiveExplosions()
+	{
+		return liveExplosions_;
+	}
+
+	void ExplosionNode::updateCurrent(sf::Time dt, CommandQueue& commands)
+	{
+		// Order does not matter, finished explosions are swapped with the last one
+		for (std::size_t i = 0; i < explosions_.size();)
+		{
+			explosions_[i].elapsedTime += dt;
+			if (clip_.isFinished(explosions_[i].elapsedTime))
+			{
+				explosions_[i] = explosions_.back();
+				explosions_.pop_back();
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		liveExplosions_ = explosions_.size();
+	}
+
+	void ExplosionNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
+	{
+		if (explosions_.empty())
+		{
+			return;
+		}
+
+		sf::Vector2f half = static_cast<sf::Vector2f>(clip_.getFrameSize()) / 2.f;
+
+		// Not replayed while its snapshot is recorded, rebuilt in place
+		sf::VertexArray& vertexArray = vertexArrays_[target.getSlot()];
+		vertexArray.clear();
+		vertexArray.setPrimitiveType(sf::Triangles);
+
+		for (const Explosion& explosion : explosions_)
+		{
+			const sf::IntRect& frame = clip_.getFrame(clip_.getFrameIndex(explosion.elapsedTime));
+			float u1 = static_cast<float>(frame.left);
+			float v1 = static_cast<float>(frame.top);
+			float u2 = u1 + frame.width;
+			float v2 = v1 + frame.height;
+
+			// Centered on the position, like centerOrigin does for the sprite
+			sf::Vector2f topLeft = explosion.position - half;
+			sf::Vector2f bottomRight = explosion.position + half;
+
+			// two triangles per explosion
+			vertexArray.append(sf::Vertex(sf::Vector2f(topLeft.x, topLeft.y), sf::Vector2f(u1, v1)));
+			vertexArray.append(sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), sf::Vector2f(u2, v1)));
+			vertexArray.append(sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), sf::Vector2f(u1, v2)));
+			vertexArray.append(sf::Vertex(sf::Vector2f(topLeft.x, bottomRight.y), sf::Vector2f(u1, v2)));
+			vertexArray.append(sf::Vertex(sf::Vector2f(bottomRight.x, topLeft.y), sf::Vector2f(u2, v1)));
+			vertexArray.append(sf::Vertex(sf::Vector2f(bottomRight.x, bottomRight.y), sf::Vector2f(u2, v2)));
+		}
+
+		states.texture = &texture_;
+		target.drawStored(vertexArray, states);
+	}
+}
@@ -0,0 +1,73 @@
+/**
+* @file
+* ExplosionNode.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "SceneNode.h"
+#include "AnimationClip.h"
+#include "TextureManager.h"
+#include <SFML/Graphics/VertexArray.hpp>
+#include <array>
+#include <vector>
+
+namespace GEX
+{
+	// Plays the explosions of destroyed entities, so the entities can be removed at once
+	// All the explosions share the clip and are drawn in a single draw call
+	class ExplosionNode : public SceneNode
+	{
+	public:
+		explicit					ExplosionNode(const TextureManager& textures);
+
+		void						add(sf::Vector2f position); //world position
+
+		// For the stats overlay
+		static std::size_t			getLiveExplosions();
+
+	private:
+		void						updateCurrent(sf::Time dt, CommandQueue& commands) override;
+		void						drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
+
+	private:
+		struct Explosion
+		{
+			sf::Vector2f			position;
+			sf::Time				elapsedTime;
+		};
+
+		static const std::size_t	PoolSize;	//when full, the oldest explosion is replaced
+
+		const sf::Texture&			texture_;
+		const AnimationClip&		clip_;
+		std::vector<Explosion>		explosions_;	//reserved to PoolSize, never reallocates
+
+		mutable std::array<sf::VertexArray, RenderSnapshot::SlotCount>	vertexArrays_;	//recorded by each snapshot
+
+		static std::size_t			liveExplosions_;
+	};
+}
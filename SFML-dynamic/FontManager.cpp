@@ -29,6 +29,7 @@
 */
 #include "FontManager.h"
 #include <cassert>
+#include <stdexcept>
 
 namespace GEX
 {
@@ -68,4 +69,22 @@ namespace GEX
 		
 		return *found->second;
 	}
+
+	void FontManager::prebuildGlyphs(FontID id, std::initializer_list<unsigned int> characterSizes)
+	{
+		sf::Font& font = get(id);
+		for (unsigned int characterSize : characterSizes)
+		{
+			for (sf::Uint32 c = ' '; c < 128; ++c)	//the range LabelBatchNode looks up
+			{
+				font.getGlyph(c, characterSize, false);
+			}
+			prebuiltSizes_.insert(std::make_pair(&font, characterSize));
+		}
+	}
+
+	bool FontManager::isPrebuilt(const sf::Font& font, unsigned int characterSize) const
+	{
+		return prebuiltSizes_.count(std::make_pair(&font, characterSize)) > 0;
+	}
 }
\ No newline at end of file
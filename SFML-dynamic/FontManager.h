@@ -30,6 +30,8 @@
 #pragma once
 #include <map>
 #include <memory>
+#include <set>
+#include <initializer_list>
 #include "ResourceIdentifier.h"
 #include <string>
 #include <SFML/Graphics/Font.hpp>
@@ -48,9 +50,15 @@ namespace GEX
 		void												load(FontID id, const std::string& path);
 		sf::Font&											get(FontID id) const;
 
+		// Renders the ASCII glyphs from space up of every size to the font pages before the render thread starts
+		// The font texture then never changes, so a text drawn on the render thread only reads the font
+		void												prebuildGlyphs(FontID id, std::initializer_list<unsigned int> characterSizes);
+		bool												isPrebuilt(const sf::Font& font, unsigned int characterSize) const;
+
 	private:
 		static FontManager*									instance_;
 		std::map<FontID, std::unique_ptr<sf::Font>>			fonts_;
+		std::set<std::pair<const sf::Font*, unsigned int>>	prebuiltSizes_;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+* @file
+* FrameArena
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "FrameArena.h"
+#include <cassert>
+#include <cstdint>
+
+namespace GEX
+{
+	FrameArena::FrameArena(std::size_t capacity)
+		: buffer_(new unsigned char[capacity])
+		, capacity_(capacity)
+		, offset_(0)
+		, overflowBytes_(0)
+		, overflow_()
+	{}
+
+	void* FrameArena::allocate(std::size_t bytes, std::size_t alignment)
+	{
+		assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+		std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+		std::size_t start = ((base + offset_ + alignment - 1) & ~(alignment - 1)) - base;
+
+		if (start + bytes <= capacity_)
+		{
+			offset_ = start + bytes;
+			return buffer_.get() + start;
+		}
+
+		// Does not fit this tick, new[] is aligned for any fundamental type
+		assert(alignment <= alignof(std::max_align_t));
+		overflowBytes_ += bytes + alignment;
+		overflow_.push_back(std::unique_ptr<unsigned char[]>(new unsigned char[bytes]));
+		return overflow_.back().get();
+	}
+
+	void FrameArena::reset()
+	{
+		if (!overflow_.empty())
+		{
+			capacity_ += overflowBytes_;
+			buffer_.reset(new unsigned char[capacity_]);
+			overflow_.clear();
+			overflowBytes_ = 0;
+		}
+
+		offset_ = 0;
+	}
+
+	std::size_t FrameArena::getUsed() const
+	{
+		return offset_ + overflowBytes_;
+	}
+
+	std::size_t FrameArena::getCapacity() const
+	{
+		return capacity_;
+	}
+}
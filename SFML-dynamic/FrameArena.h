@@ -0,0 +1,106 @@
+/**
+* @file
+* FrameArena
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <SFML/System/NonCopyable.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace GEX
+{
+	// Linear allocator for data that only lives during one tick
+	// Allocating bumps an offset, nothing is freed until reset() releases everything at once
+	class FrameArena : private sf::NonCopyable
+	{
+	public:
+		explicit					FrameArena(std::size_t capacity);
+
+		void*						allocate(std::size_t bytes, std::size_t alignment);
+
+		// Everything allocated since the last reset becomes invalid
+		// If the last tick did not fit, the arena grows to the peak so the next one does
+		void						reset();
+
+		std::size_t					getUsed() const;
+		std::size_t					getCapacity() const;
+
+	private:
+		std::unique_ptr<unsigned char[]>				buffer_;
+		std::size_t										capacity_;
+		std::size_t										offset_;
+		std::size_t										overflowBytes_;
+		std::vector<std::unique_ptr<unsigned char[]>>	overflow_;	//heap blocks of a tick that did not fit
+	};
+
+	// STL allocator drawing from a FrameArena, deallocate does nothing
+	template <typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+	public:
+		explicit					FrameAllocator(FrameArena& arena) : arena_(&arena) {}
+
+		template <typename U>
+									FrameAllocator(const FrameAllocator<U>& other) : arena_(other.arena_) {}
+
+		T*							allocate(std::size_t n)
+		{
+			return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void						deallocate(T*, std::size_t) {}
+
+	private:
+		template <typename U>
+		friend class FrameAllocator;
+
+		template <typename U, typename V>
+		friend bool					operator==(const FrameAllocator<U>& lhs, const FrameAllocator<V>& rhs);
+
+		FrameArena*					arena_;
+	};
+
+	template <typename U, typename V>
+	bool operator==(const FrameAllocator<U>& lhs, const FrameAllocator<V>& rhs)
+	{
+		return lhs.arena_ == rhs.arena_;
+	}
+
+	template <typename U, typename V>
+	bool operator!=(const FrameAllocator<U>& lhs, const FrameAllocator<V>& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
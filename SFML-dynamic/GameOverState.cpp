@@ -56,17 +56,17 @@ GameOverState::GameOverState(GEX::StateStack& stack, Context context)
 
 }
 
-void GameOverState::draw()
+void GameOverState::draw(GEX::RenderSnapshot& target)
 {
 	sf::RenderWindow& window = *getContext().window_;
-	window.setView(window.getDefaultView());
+	target.setView(window.getDefaultView());
 
 	sf::RectangleShape backgroundShape;
 	backgroundShape.setFillColor(sf::Color(0, 0, 0, 50));
-	backgroundShape.setSize(window.getView().getSize());
+	backgroundShape.setSize(window.getDefaultView().getSize());
 
-	window.draw(backgroundShape);
-	window.draw(gameOverText_);
+	target.draw(backgroundShape);
+	target.draw(gameOverText_);
 }
 
 bool GameOverState::update(sf::Time dt)
@@ -35,11 +35,19 @@ GameState::GameState(GEX::StateStack& stack, Context context)
 	, player_(*context.player_)
 {
 	context.music_->play(GEX::MusicID::MissionTheme);
+
+	// Nothing random happened yet, the session starts here
+	player_.beginSession();
+}
+
+GameState::~GameState()
+{
+	player_.endSession();
 }
 
-void GameState::draw()
+void GameState::draw(GEX::RenderSnapshot& target)
 {
-	world_.draw();
+	world_.draw(target);
 }
 
 bool GameState::update(sf::Time dt)
@@ -81,6 +89,10 @@ bool GameState::handleEvent(const sf::Event & event)
 		requestStackClear();
 		requestStackPush(GEX::StateID::Menu);
 	}
+	else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) //F3 shows the bounding boxes
+	{
+		GEX::DebugDrawNode::setEnabled(!GEX::DebugDrawNode::isEnabled());
+	}
 
 	return true;
 }
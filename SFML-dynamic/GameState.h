@@ -36,8 +36,9 @@ class GameState : public GEX::State
 {
 public:
 							GameState(GEX::StateStack& stack, Context context);
+							~GameState();
 
-	void					draw() override;
+	void					draw(GEX::RenderSnapshot& target) override;
 	bool					update(sf::Time dt) override;
 	bool					handleEvent(const sf::Event& event) override;
 
@@ -81,25 +81,25 @@ GexState::GexState(GEX::StateStack& stack, Context context)
 	instructionText2_.setPosition(0.5f * viewsize.x, 0.83f * viewsize.y);
 }
 
-void GexState::draw()
+void GexState::draw(GEX::RenderSnapshot& target)
 {
 	//Draw the elements
 	//getting window
 	sf::RenderWindow& window = *getContext().window_;
-	window.setView(window.getDefaultView());
+	target.setView(window.getDefaultView());
 
 	//Set the background
 	sf::RectangleShape backgroundShape;
 	backgroundShape.setFillColor(sf::Color(255, 0, 0, 100));
-	backgroundShape.setSize(window.getView().getSize());
+	backgroundShape.setSize(window.getDefaultView().getSize());
 
 	//Send elements to the window draw method
-	window.draw(backgroundShape);
-	window.draw(pauseText_);
-	window.draw(gexText_);
-	window.draw(faceSprite_);
-	window.draw(instructionText1_);
-	window.draw(instructionText2_);
+	target.draw(backgroundShape);
+	target.draw(pauseText_);
+	target.draw(gexText_);
+	target.draw(faceSprite_);
+	target.draw(instructionText1_);
+	target.draw(instructionText2_);
 }
 
 bool GexState::update(sf::Time dt)
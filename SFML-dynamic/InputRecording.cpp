@@ -0,0 +1,183 @@
+/**
+* @file
+* InputRecording
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "InputRecording.h"
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::uint32_t		FileMagic = 0x52584547;	//"GEXR"
+		const std::uint32_t		FileVersion = 1;
+
+		template <typename T>
+		void writeValue(std::ostream& output, const T& value)
+		{
+			output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		template <typename T>
+		void readValue(std::istream& input, T& value)
+		{
+			input.read(reinterpret_cast<char*>(&value), sizeof(T));
+		}
+	}
+
+	InputRecording::InputRecording()
+		: mode_(Mode::None)
+		, seed_(0)
+		, runs_()
+		, replayRun_(0)
+		, replayTick_(0)
+	{}
+
+	void InputRecording::startRecording(unsigned int seed)
+	{
+		mode_ = Mode::Record;
+		seed_ = seed;
+		runs_.clear();
+	}
+
+	void InputRecording::record(std::uint16_t actions)
+	{
+		if (mode_ != Mode::Record)
+		{
+			return;
+		}
+
+		if (!runs_.empty() && runs_.back().actions == actions && runs_.back().ticks < std::numeric_limits<std::uint16_t>::max())
+		{
+			runs_.back().ticks++;
+		}
+		else
+		{
+			runs_.push_back(Run{ actions, 1 });
+		}
+	}
+
+	void InputRecording::save(const std::string& path) const
+	{
+		std::ofstream output(path, std::ios::binary);
+		if (!output)
+		{
+			throw std::runtime_error("Input recording save failed: " + path);
+		}
+
+		writeValue(output, FileMagic);
+		writeValue(output, FileVersion);
+		writeValue(output, seed_);
+		writeValue(output, static_cast<std::uint32_t>(runs_.size()));
+		output.write(reinterpret_cast<const char*>(runs_.data()), runs_.size() * sizeof(Run));
+	}
+
+	void InputRecording::load(const std::string& path)
+	{
+		std::ifstream input(path, std::ios::binary);
+		if (!input)
+		{
+			throw std::runtime_error("Input recording load failed: " + path);
+		}
+
+		std::uint32_t magic = 0;
+		std::uint32_t version = 0;
+		std::uint32_t count = 0;
+		readValue(input, magic);
+		readValue(input, version);
+		readValue(input, seed_);
+		readValue(input, count);
+		if (!input || magic != FileMagic || version != FileVersion)
+		{
+			throw std::runtime_error("Input recording load failed: " + path + " is not a recording");
+		}
+
+		runs_.resize(count);
+		input.read(reinterpret_cast<char*>(runs_.data()), count * sizeof(Run));
+		if (!input)
+		{
+			throw std::runtime_error("Input recording load failed: " + path + " is truncated");
+		}
+	}
+
+	void InputRecording::startReplay()
+	{
+		mode_ = Mode::Replay;
+		replayRun_ = 0;
+		replayTick_ = 0;
+	}
+
+	std::uint16_t InputRecording::next()
+	{
+		if (mode_ != Mode::Replay || isFinished())
+		{
+			return 0;
+		}
+
+		const Run& run = runs_[replayRun_];
+		if (++replayTick_ >= run.ticks)
+		{
+			replayRun_++;
+			replayTick_ = 0;
+		}
+
+		return run.actions;
+	}
+
+	bool InputRecording::isFinished() const
+	{
+		return replayRun_ >= runs_.size();
+	}
+
+	void InputRecording::stop()
+	{
+		mode_ = Mode::None;
+	}
+
+	InputRecording::Mode InputRecording::getMode() const
+	{
+		return mode_;
+	}
+
+	unsigned int InputRecording::getSeed() const
+	{
+		return seed_;
+	}
+
+	std::size_t InputRecording::getTickCount() const
+	{
+		std::size_t ticks = 0;
+		for (const Run& run : runs_)
+		{
+			ticks += run.ticks;
+		}
+		return ticks;
+	}
+}
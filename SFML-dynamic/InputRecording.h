@@ -0,0 +1,84 @@
+/**
+* @file
+* InputRecording
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	// The player actions of every simulation tick of a game session, and the random seed it ran with
+	// Replaying it with the same seed gives the same session, so runs of different builds can be compared
+	//
+	// File format: magic, version, seed, run count, then runs of ticks with the same actions
+	class InputRecording
+	{
+	public:
+		enum class Mode
+		{
+			None,
+			Record,
+			Replay
+		};
+
+	public:
+								InputRecording();
+
+		void					startRecording(unsigned int seed);
+		void					record(std::uint16_t actions); //once per tick
+		void					save(const std::string& path) const;
+
+		void					load(const std::string& path);	//throws if it is not a complete recording
+		void					startReplay();					//from the start of the recording loaded
+		std::uint16_t			next(); //actions of the next tick, none once the recording is over
+		bool					isFinished() const;
+
+		void					stop();
+
+		Mode					getMode() const;
+		unsigned int			getSeed() const;
+		std::size_t				getTickCount() const;
+
+	private:
+		struct Run
+		{
+			std::uint16_t		actions;
+			std::uint16_t		ticks;
+		};
+
+	private:
+		Mode					mode_;
+		std::uint32_t			seed_;
+		std::vector<Run>		runs_;
+
+		std::size_t				replayRun_;		//replay cursor
+		std::uint16_t			replayTick_;
+	};
+}
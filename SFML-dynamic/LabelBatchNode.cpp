@@ -0,0 +1,192 @@
+/**
+* @file
+* LabelBatchNode.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "LabelBatchNode.h"
+#include "FontManager.h"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace GEX
+{
+	Label::Label()
+		: text_()
+		, color_(sf::Color::White)
+		, position_()
+		, rotation_(0.f)
+		, vertices_()
+		, needsLayout_(false)
+	{
+	}
+
+	void Label::setText(const std::string& text, sf::Color color)
+	{
+		if (text == text_ && color == color_)
+		{
+			return;
+		}
+
+		text_ = text;
+		color_ = color;
+		needsLayout_ = true;
+	}
+
+	const std::string & Label::getText() const
+	{
+		return text_;
+	}
+
+	void Label::setPosition(sf::Vector2f position)
+	{
+		position_ = position;
+	}
+
+	void Label::setRotation(float angle)
+	{
+		rotation_ = angle;
+	}
+
+	LabelBatchNode::LabelBatchNode(const sf::Font& font, unsigned int characterSize)
+		: SceneNode()
+		, font_(font)
+		, characterSize_(characterSize)
+		, glyphs_()
+		, texture_(nullptr)
+		, vertexArray_(sf::Triangles)
+		, drawnArrays_()
+	{
+		// The glyphs are prebuilt before the render thread starts, this only copies them
+		assert(FontManager::getInstance().isPrebuilt(font_, characterSize_));
+		for (std::size_t c = ' '; c < GlyphCount; ++c)
+		{
+			glyphs_[c] = font_.getGlyph(static_cast<sf::Uint32>(c), characterSize_, false);
+		}
+		texture_ = &font_.getTexture(characterSize_);
+	}
+
+	void LabelBatchNode::submit(Label& label, const sf::Transform& transform) const
+	{
+		if (label.needsLayout_)
+		{
+			layout(label);
+			label.needsLayout_ = false;
+		}
+
+		sf::Transform labelTransform = transform;
+		labelTransform.translate(label.position_);
+		labelTransform.rotate(label.rotation_);
+
+		for (const sf::Vertex& v : label.vertices_)
+		{
+			vertexArray_.append(sf::Vertex(labelTransform.transformPoint(v.position), v.color, v.texCoords));
+		}
+	}
+
+	void LabelBatchNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
+	{
+		// The array of the slot is not replayed while its snapshot is recorded,
+		// swapping keeps the storage of both arrays, nothing is copied or allocated
+		sf::VertexArray& drawn = drawnArrays_[target.getSlot()];
+		std::swap(drawn, vertexArray_);
+
+		states.texture = texture_;
+		target.drawStored(drawn, states);
+
+		// Labels are submitted again on the next draw
+		vertexArray_.clear();
+		vertexArray_.setPrimitiveType(sf::Triangles);
+	}
+
+	void LabelBatchNode::layout(Label& label) const
+	{
+		label.vertices_.clear();
+
+		float x = 0.f;
+		float y = static_cast<float>(characterSize_);
+		sf::Uint32 previous = 0;
+
+		float minX = std::numeric_limits<float>::max();
+		float minY = std::numeric_limits<float>::max();
+		float maxX = std::numeric_limits<float>::lowest();
+		float maxY = std::numeric_limits<float>::lowest();
+
+		for (char ch : label.text_)
+		{
+			sf::Uint32 c = static_cast<unsigned char>(ch);
+			if (c < ' ' || c >= GlyphCount)
+			{
+				continue;
+			}
+
+			x += font_.getKerning(previous, c, characterSize_);
+			previous = c;
+
+			const sf::Glyph& glyph = glyphs_[c];
+
+			float left = x + glyph.bounds.left;
+			float top = y + glyph.bounds.top;
+			float right = left + glyph.bounds.width;
+			float bottom = top + glyph.bounds.height;
+
+			float u1 = static_cast<float>(glyph.textureRect.left);
+			float v1 = static_cast<float>(glyph.textureRect.top);
+			float u2 = u1 + glyph.textureRect.width;
+			float v2 = v1 + glyph.textureRect.height;
+
+			// two triangles per glyph
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(left, top), label.color_, sf::Vector2f(u1, v1)));
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(right, top), label.color_, sf::Vector2f(u2, v1)));
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(left, bottom), label.color_, sf::Vector2f(u1, v2)));
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(left, bottom), label.color_, sf::Vector2f(u1, v2)));
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(right, top), label.color_, sf::Vector2f(u2, v1)));
+			label.vertices_.push_back(sf::Vertex(sf::Vector2f(right, bottom), label.color_, sf::Vector2f(u2, v2)));
+
+			minX = std::min(minX, left);
+			minY = std::min(minY, top);
+			maxX = std::max(maxX, right);
+			maxY = std::max(maxY, bottom);
+
+			x += glyph.advance;
+		}
+
+		if (label.vertices_.empty())
+		{
+			return;
+		}
+
+		// Center on the origin, like centerOrigin does for sf::Text
+		sf::Vector2f center(std::floor((minX + maxX) / 2.f), std::floor((minY + maxY) / 2.f));
+		for (sf::Vertex& v : label.vertices_)
+		{
+			v.position -= center;
+		}
+	}
+}
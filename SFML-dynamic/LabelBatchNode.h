@@ -0,0 +1,91 @@
+/**
+* @file
+* LabelBatchNode.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "SceneNode.h"
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Glyph.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	// Small text owned by an entity and drawn by a LabelBatchNode
+	// The glyph quads are laid out only when the text or color change
+	class Label
+	{
+	public:
+								Label();
+
+		void					setText(const std::string& text, sf::Color color = sf::Color::White);
+		const std::string&		getText() const;
+
+		void					setPosition(sf::Vector2f position);
+		void					setRotation(float angle);
+
+	private:
+		friend class LabelBatchNode;
+
+		std::string				text_;
+		sf::Color				color_;
+		sf::Vector2f			position_;
+		float					rotation_;
+
+		std::vector<sf::Vertex>	vertices_; //centered on the label origin
+		bool					needsLayout_;
+	};
+
+	// Draws every label submitted during the draw traversal in a single draw call
+	// Must be drawn after the nodes that submit labels
+	class LabelBatchNode : public SceneNode
+	{
+	public:
+								LabelBatchNode(const sf::Font& font, unsigned int characterSize);
+
+		// transform is the world transform of the label owner
+		void					submit(Label& label, const sf::Transform& transform) const;
+
+	private:
+		void					drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
+		void					layout(Label& label) const;
+
+	private:
+		static const std::size_t	GlyphCount = 128;
+
+		const sf::Font&				font_;
+		unsigned int				characterSize_;
+		std::array<sf::Glyph, GlyphCount>	glyphs_; //prebuilt, so the font texture does not change while drawing
+		const sf::Texture*			texture_;	//font page of characterSize_, looked up once
+
+		mutable sf::VertexArray		vertexArray_;	//labels submitted this draw
+		mutable std::array<sf::VertexArray, RenderSnapshot::SlotCount>	drawnArrays_;	//recorded by each snapshot
+	};
+}
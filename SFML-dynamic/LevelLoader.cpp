@@ -0,0 +1,347 @@
+/**
+* @file
+* LevelLoader.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "LevelLoader.h"
+#include "DataTables.h"
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		const std::uint32_t CacheMagic = 0x4C584547; // "GEXL"
+		const std::uint32_t CacheVersion = 2;
+
+		const std::map<std::string, AircraftType> AircraftNames =
+		{
+			{ "Eagle", AircraftType::Eagle },
+			{ "Raptor", AircraftType::Raptor },
+			{ "Avenger", AircraftType::Avenger },
+		};
+
+		const std::map<std::string, Projectile::Type> ProjectileNames =
+		{
+			{ "AlliedBullet", Projectile::Type::AlliedBullet },
+			{ "EnemyBullet", Projectile::Type::EnemyBullet },
+			{ "Missile", Projectile::Type::Missile },
+		};
+
+		const std::map<std::string, StatOverride::Field> AircraftFields =
+		{
+			{ "hitpoints", StatOverride::Field::Hitpoints },
+			{ "speed", StatOverride::Field::Speed },
+			{ "fireInterval", StatOverride::Field::FireInterval },
+			{ "missiles", StatOverride::Field::MissileAmount },
+		};
+
+		const std::map<std::string, StatOverride::Field> ProjectileFields =
+		{
+			{ "damage", StatOverride::Field::Damage },
+			{ "speed", StatOverride::Field::Speed },
+		};
+
+		// FNV-1a, used to tell if the cache was built from the current text and is intact
+		std::uint64_t hashSource(const std::string& source)
+		{
+			std::uint64_t hash = 14695981039346656037ull;
+			for (char c : source)
+			{
+				hash ^= static_cast<unsigned char>(c);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		template <typename Name>
+		Name lookup(const std::map<std::string, Name>& names, const std::string& name, const std::string& path, int line)
+		{
+			auto found = names.find(name);
+			if (found == names.end())
+			{
+				throw std::runtime_error("Level load failed: " + path + ":" + std::to_string(line) + " unknown name " + name);
+			}
+			return found->second;
+		}
+
+		LevelData parseLevel(const std::string& source, const std::string& path)
+		{
+			LevelData level;
+			std::istringstream input(source);
+			std::string line;
+			int lineNumber = 0;
+
+			while (std::getline(input, line))
+			{
+				lineNumber++;
+				line = line.substr(0, line.find('#'));
+
+				std::istringstream tokens(line);
+				std::string keyword;
+				if (!(tokens >> keyword))
+				{
+					continue; //blank line
+				}
+
+				if (keyword == "spawn")
+				{
+					std::string name;
+					SpawnData spawn;
+					if (!(tokens >> name >> spawn.x >> spawn.y) || !(tokens >> std::ws).eof())
+					{
+						throw std::runtime_error("Level load failed: " + path + ":" + std::to_string(lineNumber));
+					}
+					spawn.type = lookup(AircraftNames, name, path, lineNumber);
+					level.spawns.push_back(spawn);
+				}
+				else if (keyword == "aircraft" || keyword == "projectile")
+				{
+					bool isAircraft = keyword == "aircraft";
+					std::string name;
+					tokens >> name;
+
+					StatOverride stat;
+					stat.table = isAircraft ? StatOverride::Table::Aircraft : StatOverride::Table::Projectile;
+					stat.type = isAircraft
+						? static_cast<std::uint8_t>(lookup(AircraftNames, name, path, lineNumber))
+						: static_cast<std::uint8_t>(lookup(ProjectileNames, name, path, lineNumber));
+
+					std::string field;
+					while (tokens >> field)
+					{
+						// A value that is missing or not a number would otherwise end the line silently
+						if (!(tokens >> stat.value))
+						{
+							throw std::runtime_error("Level load failed: " + path + ":" + std::to_string(lineNumber) + " bad value for " + field);
+						}
+						stat.field = lookup(isAircraft ? AircraftFields : ProjectileFields, field, path, lineNumber);
+						level.overrides.push_back(stat);
+					}
+				}
+				else
+				{
+					throw std::runtime_error("Level load failed: " + path + ":" + std::to_string(lineNumber) + " unknown keyword " + keyword);
+				}
+			}
+
+			return level;
+		}
+
+		template <typename T>
+		void writeValue(std::ostream& output, const T& value)
+		{
+			output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		template <typename T>
+		void readValue(std::istream& input, T& value)
+		{
+			input.read(reinterpret_cast<char*>(&value), sizeof(T));
+		}
+
+		void writeCache(const std::string& cachePath, std::uint64_t sourceHash, const LevelData& level)
+		{
+			std::ostringstream payload(std::ios::binary);
+			writeValue(payload, static_cast<std::uint32_t>(level.spawns.size()));
+			payload.write(reinterpret_cast<const char*>(level.spawns.data()), level.spawns.size() * sizeof(SpawnData));
+
+			writeValue(payload, static_cast<std::uint32_t>(level.overrides.size()));
+			payload.write(reinterpret_cast<const char*>(level.overrides.data()), level.overrides.size() * sizeof(StatOverride));
+
+			std::ofstream output(cachePath, std::ios::binary);
+			if (!output)
+			{
+				return; //no cache this time, the text is still loaded
+			}
+
+			const std::string data = payload.str();
+			writeValue(output, CacheMagic);
+			writeValue(output, CacheVersion);
+			writeValue(output, sourceHash);
+			writeValue(output, hashSource(data));
+			output.write(data.data(), data.size());
+		}
+
+		bool isValid(const SpawnData& spawn)
+		{
+			return static_cast<unsigned int>(spawn.type) < static_cast<unsigned int>(AircraftType::Count);
+		}
+
+		bool isValid(const StatOverride& stat)
+		{
+			return stat.table <= StatOverride::Table::Projectile && stat.field <= StatOverride::Field::Damage;
+		}
+
+		// Reads a count and that many records, the count may not claim more than the data left
+		template <typename T>
+		bool readRecords(std::istream& input, std::size_t bytesLeft, std::vector<T>& records)
+		{
+			std::uint32_t count = 0;
+			readValue(input, count);
+			if (!input || count > (bytesLeft - sizeof(count)) / sizeof(T))
+			{
+				return false;
+			}
+
+			records.resize(count);
+			input.read(reinterpret_cast<char*>(records.data()), count * sizeof(T));
+			if (!input)
+			{
+				return false;
+			}
+
+			for (const T& record : records)
+			{
+				if (!isValid(record))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Returns false if there is no usable cache
+		// The payload hash is always checked, the source hash only when the text is available
+		bool readCache(const std::string& cachePath, const std::uint64_t* sourceHash, LevelData& level)
+		{
+			std::ifstream input(cachePath, std::ios::binary);
+			if (!input)
+			{
+				return false;
+			}
+
+			std::uint32_t magic = 0;
+			std::uint32_t version = 0;
+			std::uint64_t hash = 0;
+			std::uint64_t payloadHash = 0;
+			readValue(input, magic);
+			readValue(input, version);
+			readValue(input, hash);
+			readValue(input, payloadHash);
+			if (!input || magic != CacheMagic || version != CacheVersion || (sourceHash && hash != *sourceHash))
+			{
+				return false;
+			}
+
+			const std::string payload((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+			if (hashSource(payload) != payloadHash)
+			{
+				return false;
+			}
+
+			std::istringstream data(payload, std::ios::binary);
+			if (!readRecords(data, payload.size(), level.spawns))
+			{
+				return false;
+			}
+
+			const std::size_t read = level.spawns.size() * sizeof(SpawnData) + sizeof(std::uint32_t);
+			return readRecords(data, payload.size() - read, level.overrides)
+				&& data.tellg() == static_cast<std::streamoff>(payload.size());
+		}
+	}
+
+	LevelData loadLevel(const std::string& textPath, const std::string& cachePath)
+	{
+		LevelData level;
+
+		std::ifstream text(textPath, std::ios::binary);
+		if (!text)
+		{
+			if (!readCache(cachePath, nullptr, level))
+			{
+				throw std::runtime_error("Level load failed: " + textPath);
+			}
+			return level;
+		}
+
+		std::string source((std::istreambuf_iterator<char>(text)), std::istreambuf_iterator<char>());
+		std::uint64_t sourceHash = hashSource(source);
+
+		if (!readCache(cachePath, &sourceHash, level))
+		{
+			level = parseLevel(source, textPath);
+			writeCache(cachePath, sourceHash, level);
+		}
+
+		return level;
+	}
+
+	void applyLevelStats(const LevelData& level)
+	{
+		AircraftTable& aircraft = getAircraftTable();
+		ProjectileTable& projectiles = getProjectileTable();
+
+		aircraft = initializeAircraftData();
+		projectiles = initializeProjectileData();
+
+		for (const StatOverride& stat : level.overrides)
+		{
+			if (stat.table == StatOverride::Table::Aircraft && stat.type < aircraft.size())
+			{
+				AircraftData& data = aircraft[stat.type];
+				switch (stat.field)
+				{
+				case StatOverride::Field::Hitpoints:
+					data.hitpoints = static_cast<int>(stat.value);
+					break;
+				case StatOverride::Field::Speed:
+					data.speed = stat.value;
+					break;
+				case StatOverride::Field::FireInterval:
+					data.fireInterval = sf::seconds(stat.value);
+					break;
+				case StatOverride::Field::MissileAmount:
+					data.missileAmount = static_cast<int>(stat.value);
+					break;
+				default:
+					break;
+				}
+			}
+			else if (stat.table == StatOverride::Table::Projectile && stat.type < projectiles.size())
+			{
+				ProjectileData& data = projectiles[stat.type];
+				switch (stat.field)
+				{
+				case StatOverride::Field::Damage:
+					data.damage = static_cast<int>(stat.value);
+					break;
+				case StatOverride::Field::Speed:
+					data.speed = stat.value;
+					break;
+				default:
+					break;
+				}
+			}
+		}
+	}
+}
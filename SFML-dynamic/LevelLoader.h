@@ -0,0 +1,88 @@
+/**
+* @file
+* LevelLoader.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "Aircraft.h"
+#include "Projectile.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GEX
+{
+	// Enemy spawn, relative to the player spawn position (y goes up the level)
+	struct SpawnData
+	{
+		AircraftType		type;
+		float				x;
+		float				y;
+	};
+
+	// One stat of one table entry replaced by the level
+	struct StatOverride
+	{
+		enum class Table : std::uint8_t
+		{
+			Aircraft,
+			Projectile
+		};
+
+		enum class Field : std::uint8_t
+		{
+			Hitpoints,		//aircraft
+			Speed,			//aircraft and projectile
+			FireInterval,	//aircraft, in seconds
+			MissileAmount,	//aircraft
+			Damage			//projectile
+		};
+
+		Table				table;
+		std::uint8_t		type;
+		Field				field;
+		float				value;
+	};
+
+	struct LevelData
+	{
+		std::vector<SpawnData>		spawns;
+		std::vector<StatOverride>	overrides;
+	};
+
+	// Level files are authored as text and compiled to a binary cache next to them
+	// The cache is used while it matches the text, or alone when the text is not shipped
+	//
+	// Text format, one entry per line, '#' starts a comment:
+	//		spawn <aircraft> <x> <y>
+	//		aircraft <aircraft> [hitpoints <n>] [speed <n>] [fireInterval <seconds>] [missiles <n>]
+	//		projectile <projectile> [damage <n>] [speed <n>]
+	LevelData			loadLevel(const std::string& textPath, const std::string& cachePath);
+
+	// Reset the shared data tables to their defaults and apply the level overrides
+	void				applyLevelStats(const LevelData& level);
+}
@@ -63,16 +63,16 @@ MenuState::MenuState(GEX::StateStack& stack, Context context)
 	context.music_->play(GEX::MusicID::MenuTheme);
 }
 
-void MenuState::draw()
+void MenuState::draw(GEX::RenderSnapshot& target)
 {
 	auto& window = *getContext().window_;
 
-	window.setView(window.getDefaultView());
-	window.draw(backgroundSprite_);
+	target.setView(window.getDefaultView());
+	target.draw(backgroundSprite_);
 
 	for (const sf::Text& text : options_)
 	{
-		window.draw(text);
+		target.draw(text);
 	}
 	
 }
@@ -36,7 +36,7 @@ class MenuState : public GEX::State
 public:
 	MenuState(GEX::StateStack& stack, Context context);
 
-	void					draw() override;
+	void					draw(GEX::RenderSnapshot& target) override;
 	bool					update(sf::Time dt) override;
 	bool					handleEvent(const sf::Event& event) override;
 
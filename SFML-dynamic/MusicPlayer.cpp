@@ -28,13 +28,23 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 #include "MusicPlayer.h"
-
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
 
 namespace GEX {
-	MusicPlayer::MusicPlayer()
-		: music_()
+	MusicPlayer::MusicPlayer(AudioBackend& backend)
+		: streams_({ { backend.createMusicStream(), backend.createMusicStream() } })
+		, current_(0)
 		, filenames_()
 		, volume_(25)
+		, fadeDuration_(sf::seconds(1.5f))
+		, fadeTime_(sf::Time::Zero)
+		, isFading_(false)
+		, playWhenLoaded_(false)
+		, hasQueuedTheme_(false)
+		, queuedTheme_(MusicID::MenuTheme)
+		, loading_()
 	{
 		filenames_[MusicID::MissionTheme] = "Media/Music/MissionTheme.ogg";
 		filenames_[MusicID::MenuTheme] = "Media/Music/MenuTheme.ogg";
@@ -42,39 +52,139 @@ namespace GEX {
 
 	void MusicPlayer::play(MusicID theme)
 	{
-		if (!music_.openFromFile(filenames_.at(theme)))
+		playWhenLoaded_ = true;
+
+		// Only one stream can be opened at a time, the last request wins
+		if (loading_.valid())
 		{
-			throw std::runtime_error("Music could not open file");
+			queuedTheme_ = theme;
+			hasQueuedTheme_ = true;
+			return;
 		}
 
-		music_.setVolume(volume_);
-		music_.setLoop(true);
-		music_.play();
+		startLoading(theme);
 	}
 
 	void MusicPlayer::stop()
 	{
-		music_.stop();
+		playWhenLoaded_ = false;
+		hasQueuedTheme_ = false;
+		isFading_ = false;
+
+		currentMusic().stop();
+		if (!loading_.valid())
+		{
+			otherMusic().stop();
+		}
 	}
 
 	void MusicPlayer::setPaused(bool paused)
 	{
 		if(paused)
 		{
-			music_.pause();
+			currentMusic().pause();
+			if (isFading_)
+			{
+				otherMusic().pause();
+			}
 		}
 		else
 		{
-			music_.play();
+			currentMusic().play();
+			if (isFading_)
+			{
+				otherMusic().play();
+			}
 		}
 	}
 
 	void MusicPlayer::setVolume(float volume)
 	{
 		volume_ = volume;
-		music_.setVolume(volume_);
+		if (!isFading_)
+		{
+			currentMusic().setVolume(volume_);
+		}
+	}
+
+	void MusicPlayer::update(sf::Time dt)
+	{
+		// Background load finished?
+		if (loading_.valid() && loading_.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		{
+			if (!loading_.get())
+			{
+				throw std::runtime_error("Music could not open file");
+			}
+
+			if (hasQueuedTheme_)
+			{
+				hasQueuedTheme_ = false;
+				startLoading(queuedTheme_);
+			}
+			else if (playWhenLoaded_)
+			{
+				startCrossfade();
+			}
+		}
+
+		// Paused streams keep their fade where it is
+		if (isFading_ && currentMusic().isPlaying())
+		{
+			fadeTime_ += dt;
+			float ratio = std::min(fadeTime_ / fadeDuration_, 1.f);
+
+			currentMusic().setVolume(volume_ * ratio);
+			otherMusic().setVolume(volume_ * (1.f - ratio));
+
+			if (ratio >= 1.f)
+			{
+				otherMusic().stop();
+				isFading_ = false;
+			}
+		}
 	}
 
+	void MusicPlayer::startLoading(MusicID theme)
+	{
+		// The idle stream may still be fading out, cut it short
+		if (isFading_)
+		{
+			currentMusic().setVolume(volume_);
+			isFading_ = false;
+		}
+		otherMusic().stop();
+
+		// Opening the file reads and decodes the first chunk, keep it off the game loop
+		MusicStream& music = otherMusic();
+		const std::string filename = filenames_.at(theme);
+		loading_ = std::async(std::launch::async, [&music, filename]()
+		{
+			return music.openFromFile(filename);
+		});
+	}
+
+	void MusicPlayer::startCrossfade()
+	{
+		current_ = 1 - current_;
+
+		MusicStream& music = currentMusic();
+		music.setVolume(0.f);
+		music.setLoop(true);
+		music.play();
+
+		fadeTime_ = sf::Time::Zero;
+		isFading_ = true;
+	}
+
+	MusicStream & MusicPlayer::currentMusic()
+	{
+		return *streams_[current_];
+	}
+
+	MusicStream & MusicPlayer::otherMusic()
+	{
+		return *streams_[1 - current_];
+	}
 
-	
-}
\ No newline at end of file
+}
@@ -29,16 +29,20 @@
 */
 #pragma once
 
-#include <SFML/Audio/Music.hpp>
+#include <SFML/System/Time.hpp>
 #include "ResourceIdentifier.h"
+#include "AudioBackend.h"
 #include <map>
+#include <array>
+#include <future>
+#include <memory>
 #include <string>
 
 namespace GEX {
 	class MusicPlayer
 	{
 	public:
-											MusicPlayer();
+		explicit							MusicPlayer(AudioBackend& backend);
 											~MusicPlayer() = default;
 											MusicPlayer(const MusicPlayer&) = delete;
 		MusicPlayer&						operator=(const MusicPlayer&) = delete;
@@ -48,10 +52,31 @@ namespace GEX {
 		void								setPaused(bool paused);
 		void								setVolume(float volume);
 
+		void								update(sf::Time dt); //finish background loads and run the crossfade
+
+	private:
+		void								startLoading(MusicID theme);
+		void								startCrossfade();
+		MusicStream&						currentMusic();
+		MusicStream&						otherMusic();
+
 	private:
-		sf::Music							music_;
+		// Two streams, one playing and one being opened or fading out
+		std::array<std::unique_ptr<MusicStream>, 2>	streams_;
+		std::size_t							current_;
 		std::map<MusicID, std::string>		filenames_;
 		float								volume_;
+
+		sf::Time							fadeDuration_;
+		sf::Time							fadeTime_;
+		bool								isFading_;
+
+		bool								playWhenLoaded_;
+		bool								hasQueuedTheme_;
+		MusicID								queuedTheme_;
+
+		// Declared after the streams, so a pending load is waited on before they are destroyed
+		std::future<bool>					loading_;
 	};
 
 }
@@ -0,0 +1,121 @@
+/**
+* @file
+* NullAudioBackend.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "NullAudioBackend.h"
+
+namespace GEX
+{
+	NullMusicStream::NullMusicStream()
+		: isPlaying_(false)
+	{
+	}
+
+	bool NullMusicStream::openFromFile(const std::string& path)
+	{
+		return true;
+	}
+
+	void NullMusicStream::play()
+	{
+		isPlaying_ = true;
+	}
+
+	void NullMusicStream::pause()
+	{
+		isPlaying_ = false;
+	}
+
+	void NullMusicStream::stop()
+	{
+		isPlaying_ = false;
+	}
+
+	void NullMusicStream::setVolume(float volume)
+	{
+		// nothing to play
+	}
+
+	void NullMusicStream::setLoop(bool loop)
+	{
+		// nothing to play
+	}
+
+	bool NullMusicStream::isPlaying() const
+	{
+		return isPlaying_;
+	}
+
+	NullAudioBackend::NullAudioBackend()
+		: listenerPosition_()
+		, voiceCount_(0)
+		, totalPlayed_(0)
+	{
+	}
+
+	void NullAudioBackend::loadBuffer(SoundEffectID id, const std::string& path)
+	{
+		// nothing to load
+	}
+
+	void NullAudioBackend::play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume)
+	{
+		voiceCount_++;
+		totalPlayed_++;
+	}
+
+	void NullAudioBackend::removeStoppedSounds()
+	{
+		voiceCount_ = 0;
+	}
+
+	void NullAudioBackend::setListenerPosition(sf::Vector3f position)
+	{
+		listenerPosition_ = position;
+	}
+
+	sf::Vector3f NullAudioBackend::getListenerPosition() const
+	{
+		return listenerPosition_;
+	}
+
+	std::size_t NullAudioBackend::getVoiceCount() const
+	{
+		return voiceCount_;
+	}
+
+	std::size_t NullAudioBackend::getTotalPlayed() const
+	{
+		return totalPlayed_;
+	}
+
+	std::unique_ptr<MusicStream> NullAudioBackend::createMusicStream()
+	{
+		return std::unique_ptr<MusicStream>(new NullMusicStream());
+	}
+}
@@ -0,0 +1,77 @@
+/**
+* @file
+* NullAudioBackend.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "AudioBackend.h"
+
+namespace GEX
+{
+	// Opens nothing and plays silence, only the playing state is kept
+	class NullMusicStream : public MusicStream
+	{
+	public:
+								NullMusicStream();
+
+		bool					openFromFile(const std::string& path) override;
+		void					play() override;
+		void					pause() override;
+		void					stop() override;
+		void					setVolume(float volume) override;
+		void					setLoop(bool loop) override;
+		bool					isPlaying() const override;
+
+	private:
+		bool					isPlaying_;
+	};
+
+	// Accepts everything and plays nothing, for machines without an audio device
+	// Voices are counted as if they were played and forgotten on the next cleanup
+	class NullAudioBackend : public AudioBackend
+	{
+	public:
+								NullAudioBackend();
+
+		void					loadBuffer(SoundEffectID id, const std::string& path) override;
+		void					play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume) override;
+		void					removeStoppedSounds() override;
+
+		void					setListenerPosition(sf::Vector3f position) override;
+		sf::Vector3f			getListenerPosition() const override;
+
+		std::size_t				getVoiceCount() const override;
+		std::size_t				getTotalPlayed() const;
+
+		std::unique_ptr<MusicStream>	createMusicStream() override;
+
+	private:
+		sf::Vector3f			listenerPosition_;
+		std::size_t				voiceCount_;
+		std::size_t				totalPlayed_;
+	};
+}
@@ -0,0 +1,162 @@
+/**
+* @file
+* OfflineAudioMixer.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "OfflineAudioMixer.h"
+#include "NullAudioBackend.h"
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace GEX
+{
+	OfflineAudioMixer::OfflineAudioMixer(unsigned int sampleRate)
+		: sampleRate_(sampleRate)
+		, listenerPosition_()
+		, buffers_()
+		, voices_()
+	{
+	}
+
+	void OfflineAudioMixer::loadBuffer(SoundEffectID id, const std::string& path)
+	{
+		// sf::InputSoundFile only decodes, no audio device is needed
+		sf::InputSoundFile file;
+		if (!file.openFromFile(path))
+		{
+			throw std::runtime_error("Sound effect load failed");
+		}
+
+		Samples samples;
+		samples.channelCount = file.getChannelCount();
+		samples.sampleRate = file.getSampleRate();
+		samples.data.resize(static_cast<std::size_t>(file.getSampleCount()));
+		file.read(samples.data.data(), samples.data.size());
+
+		auto inserted = buffers_.insert(std::make_pair(id, std::move(samples)));
+		assert(inserted.second);
+	}
+
+	void OfflineAudioMixer::play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume)
+	{
+		Voice voice;
+		voice.samples = &buffers_.at(id);
+		voice.position = position;
+		voice.attenuation = attenuation;
+		voice.minDistance = minDistance;
+		voice.volume = volume;
+		voice.cursor = 0.0;
+
+		voices_.push_back(voice);
+	}
+
+	void OfflineAudioMixer::removeStoppedSounds()
+	{
+		auto stopped = std::remove_if(voices_.begin(), voices_.end(), [](const Voice& v)
+		{
+			return v.cursor >= v.samples->data.size() / v.samples->channelCount;
+		});
+		voices_.erase(stopped, voices_.end());
+	}
+
+	void OfflineAudioMixer::setListenerPosition(sf::Vector3f position)
+	{
+		listenerPosition_ = position;
+	}
+
+	sf::Vector3f OfflineAudioMixer::getListenerPosition() const
+	{
+		return listenerPosition_;
+	}
+
+	std::size_t OfflineAudioMixer::getVoiceCount() const
+	{
+		return voices_.size();
+	}
+
+	std::unique_ptr<MusicStream> OfflineAudioMixer::createMusicStream()
+	{
+		return std::unique_ptr<MusicStream>(new NullMusicStream());
+	}
+
+	void OfflineAudioMixer::render(std::vector<sf::Int16>& output, std::size_t sampleCount)
+	{
+		std::vector<float> mix(sampleCount, 0.f);
+
+		for (auto& v : voices_)
+		{
+			const Samples& src = *v.samples;
+			const std::size_t frameCount = src.data.size() / src.channelCount;
+			const double step = static_cast<double>(src.sampleRate) / sampleRate_;
+			const float gain = computeGain(listenerPosition_, v.position, v.attenuation, v.minDistance) * v.volume / 100.f;
+
+			for (std::size_t i = 0; i < sampleCount; ++i)
+			{
+				std::size_t frame = static_cast<std::size_t>(v.cursor);
+				if (frame >= frameCount)
+				{
+					break;
+				}
+
+				// Down mix to mono
+				float value = 0.f;
+				for (unsigned int c = 0; c < src.channelCount; ++c)
+				{
+					value += src.data[frame * src.channelCount + c];
+				}
+				mix[i] += gain * value / static_cast<float>(src.channelCount);
+
+				v.cursor += step;
+			}
+		}
+
+		output.reserve(output.size() + sampleCount);
+		for (float value : mix)
+		{
+			value = std::max(-32768.f, std::min(value, 32767.f));
+			output.push_back(static_cast<sf::Int16>(value));
+		}
+	}
+
+	unsigned int OfflineAudioMixer::getSampleRate() const
+	{
+		return sampleRate_;
+	}
+
+	float OfflineAudioMixer::computeGain(sf::Vector3f listener, sf::Vector3f position, float attenuation, float minDistance)
+	{
+		float dx = position.x - listener.x;
+		float dy = position.y - listener.y;
+		float dz = position.z - listener.z;
+		float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz), minDistance);
+
+		return minDistance / (minDistance + attenuation * (distance - minDistance));
+	}
+}
@@ -0,0 +1,88 @@
+/**
+* @file
+* OfflineAudioMixer.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "AudioBackend.h"
+#include <SFML/Config.hpp>
+#include <map>
+#include <vector>
+
+namespace GEX
+{
+	// Software mixer that renders the voices to a mono PCM buffer instead of a device
+	// Uses the same distance model as OpenAL (inverse distance, clamped) so the output
+	// matches what the game would sound like, and is deterministic for a given sequence of calls
+	class OfflineAudioMixer : public AudioBackend
+	{
+	public:
+		explicit							OfflineAudioMixer(unsigned int sampleRate = 44100);
+
+		void								loadBuffer(SoundEffectID id, const std::string& path) override;
+		void								play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume) override;
+		void								removeStoppedSounds() override;
+
+		void								setListenerPosition(sf::Vector3f position) override;
+		sf::Vector3f						getListenerPosition() const override;
+
+		std::size_t							getVoiceCount() const override;
+
+		// The music is not mixed, only the sound effects
+		std::unique_ptr<MusicStream>		createMusicStream() override;
+
+		// Mix the next sampleCount samples of all the voices, appending them to output
+		void								render(std::vector<sf::Int16>& output, std::size_t sampleCount);
+		unsigned int						getSampleRate() const;
+
+		static float						computeGain(sf::Vector3f listener, sf::Vector3f position, float attenuation, float minDistance);
+
+	private:
+		struct Samples
+		{
+			std::vector<sf::Int16>			data;
+			unsigned int					channelCount;
+			unsigned int					sampleRate;
+		};
+
+		struct Voice
+		{
+			const Samples*					samples;
+			sf::Vector3f					position;
+			float							attenuation;
+			float							minDistance;
+			float							volume;
+			double							cursor; //position in source frames
+		};
+
+	private:
+		unsigned int						sampleRate_;
+		sf::Vector3f						listenerPosition_;
+		std::map<SoundEffectID, Samples>	buffers_;
+		std::vector<Voice>					voices_;
+	};
+}
@@ -0,0 +1,114 @@
+/**
+* @file
+* OpenALAudioBackend.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "OpenALAudioBackend.h"
+#include <SFML/Audio/Listener.hpp>
+#include <SFML/Audio/Music.hpp>
+#include <cassert>
+#include <stdexcept>
+
+namespace GEX
+{
+	namespace
+	{
+		class OpenALMusicStream : public MusicStream
+		{
+		public:
+			bool		openFromFile(const std::string& path) override	{ return music_.openFromFile(path); }
+			void		play() override									{ music_.play(); }
+			void		pause() override								{ music_.pause(); }
+			void		stop() override									{ music_.stop(); }
+			void		setVolume(float volume) override				{ music_.setVolume(volume); }
+			void		setLoop(bool loop) override						{ music_.setLoop(loop); }
+			bool		isPlaying() const override						{ return music_.getStatus() == sf::Music::Playing; }
+
+		private:
+			sf::Music	music_;
+		};
+	}
+
+	OpenALAudioBackend::OpenALAudioBackend()
+		: soundBuffers_()
+		, sounds_()
+	{
+		// Listener points towards the screen (default in SFML)
+		sf::Listener::setDirection(0.f, 0.f, -1.f);
+	}
+
+	void OpenALAudioBackend::loadBuffer(SoundEffectID id, const std::string& path)
+	{
+		std::unique_ptr<sf::SoundBuffer> buffer(new sf::SoundBuffer);
+		if (!buffer->loadFromFile(path))
+		{
+			throw std::runtime_error("Sound effect load failed");
+		}
+
+		auto inserted = soundBuffers_.insert(std::make_pair(id, std::move(buffer)));
+		assert(inserted.second);
+	}
+
+	void OpenALAudioBackend::play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume)
+	{
+		sounds_.push_back(sf::Sound());
+		sf::Sound& sound = sounds_.back();
+
+		sound.setBuffer(*soundBuffers_.at(id));
+		sound.setPosition(position);
+		sound.setAttenuation(attenuation);
+		sound.setMinDistance(minDistance);
+
+		sound.setVolume(volume);
+		sound.play();
+	}
+
+	void OpenALAudioBackend::removeStoppedSounds()
+	{
+		sounds_.remove_if([](const sf::Sound& s) {return s.getStatus() == sf::Sound::Stopped; });
+	}
+
+	void OpenALAudioBackend::setListenerPosition(sf::Vector3f position)
+	{
+		sf::Listener::setPosition(position);
+	}
+
+	sf::Vector3f OpenALAudioBackend::getListenerPosition() const
+	{
+		return sf::Listener::getPosition();
+	}
+
+	std::size_t OpenALAudioBackend::getVoiceCount() const
+	{
+		return sounds_.size();
+	}
+
+	std::unique_ptr<MusicStream> OpenALAudioBackend::createMusicStream()
+	{
+		return std::unique_ptr<MusicStream>(new OpenALMusicStream());
+	}
+}
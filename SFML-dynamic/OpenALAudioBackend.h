@@ -0,0 +1,62 @@
+/**
+* @file
+* OpenALAudioBackend.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "AudioBackend.h"
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Audio/Sound.hpp>
+
+#include <map>
+#include <memory>
+#include <list>
+
+namespace GEX
+{
+	// Plays the sounds on the audio device through sf::Sound and sf::Listener
+	class OpenALAudioBackend : public AudioBackend
+	{
+	public:
+																	OpenALAudioBackend();
+
+		void														loadBuffer(SoundEffectID id, const std::string& path) override;
+		void														play(SoundEffectID id, sf::Vector3f position, float attenuation, float minDistance, float volume) override;
+		void														removeStoppedSounds() override;
+
+		void														setListenerPosition(sf::Vector3f position) override;
+		sf::Vector3f												getListenerPosition() const override;
+
+		std::size_t													getVoiceCount() const override;
+
+		std::unique_ptr<MusicStream>								createMusicStream() override;
+
+	private:
+		std::map<SoundEffectID, std::unique_ptr<sf::SoundBuffer>>	soundBuffers_;
+		std::list<sf::Sound>										sounds_;
+	};
+}
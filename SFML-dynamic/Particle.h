@@ -45,7 +45,8 @@ namespace GEX
 
 		sf::Vector2f	position;
 		sf::Color		color;
-		sf::Time		lifetime;
+		sf::Time		birth;			//time of the particle system when emitted
+		sf::Time		lifetime;		//shortened when the budget is tight
 
 	};
 }
@@ -29,32 +29,160 @@
 */
 #include "ParticleNode.h"
 #include "DataTables.h"
+#include "ParticleRegistry.h"
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
 
 namespace GEX
 {
 	namespace
 	{
-		const std::map<Particle::Type, ParticleData> TABLE = initializeParticleData();
+		const ParticleTable TABLE = initializeParticleData();
+	}
+
+	// Keeps the particle quads in a stream vertex buffer between frames
+	// Only used on the render thread, falls back to plain vertex arrays without vertex buffer support
+	//
+	// Uploads go to successive ranges of a buffer about three uploads long, so a range is not
+	// written again while the GPU may still draw from it, and the driver never has to wait
+	class ParticleStream
+	{
+	public:
+		ParticleStream()
+			: buffer_(sf::Quads, sf::VertexBuffer::Stream)
+			, drawOffset_(0)
+			, writeOffset_(0)
+			, vertexCount_(0)
+			, revision_(0)
+			, hasUpload_(false)
+		{}
+
+		void draw(sf::RenderTarget& target, sf::RenderStates states, const std::vector<sf::Vertex>& vertices, unsigned int revision)
+		{
+			if (!ParticleNode::isUsingVertexBuffers() || !sf::VertexBuffer::isAvailable())
+			{
+				if (!vertices.empty())
+				{
+					target.draw(vertices.data(), vertices.size(), sf::Quads, states);
+				}
+				return;
+			}
+
+			// Only upload when the particles moved since the last upload, and only the live range
+			if (!hasUpload_ || revision != revision_)
+			{
+				std::size_t needed = vertices.size() * RangeCount;
+				if (needed > buffer_.getVertexCount())
+				{
+					// Grow by doubling, creating again orphans the old storage
+					std::size_t capacity = std::max<std::size_t>(buffer_.getVertexCount(), 256);
+					while (capacity < needed)
+					{
+						capacity *= 2;
+					}
+					buffer_.create(capacity);
+					writeOffset_ = 0;
+				}
+
+				// Wrap to the start when the next range does not fit
+				if (writeOffset_ + vertices.size() > buffer_.getVertexCount())
+				{
+					writeOffset_ = 0;
+				}
+
+				if (!vertices.empty())
+				{
+					buffer_.update(vertices.data(), vertices.size(), static_cast<unsigned int>(writeOffset_));
+				}
+
+				drawOffset_ = writeOffset_;
+				writeOffset_ += vertices.size();
+				vertexCount_ = vertices.size();
+				revision_ = revision;
+				hasUpload_ = true;
+			}
+
+			if (vertexCount_ > 0)
+			{
+				target.draw(buffer_, drawOffset_, vertexCount_, states);
+			}
+		}
+
+	private:
+		static const std::size_t	RangeCount = 3;
+
+		sf::VertexBuffer		buffer_;
+		std::size_t				drawOffset_;	//range of the last upload
+		std::size_t				writeOffset_;	//where the next one goes
+		std::size_t				vertexCount_;
+		unsigned int			revision_;
+		bool					hasUpload_;
+	};
+
+	bool ParticleNode::vertexBuffers_ = true;
+
+	ParticleNode::ParticleBatch::ParticleBatch()
+		: stream()
+		, vertices()
+		, revision(0)
+	{
+	}
+
+	void ParticleNode::ParticleBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const
+	{
+		stream->draw(target, states, vertices, revision);
 	}
 
 	ParticleNode::ParticleNode(Particle::Type type, GEX::TextureManager& textture)
 		: SceneNode()
-		, particles_()
+		, particles_(TABLE[toIndex(type)].maxParticles)
+		, head_(0)
+		, count_(0)
+		, elapsedTime_(sf::Time::Zero)
 		, texture_(textture.get(GEX::TextureID::Particle))
 		, type_(type)
-		, vertexArray_(sf::Quads)
-		, needsVertexUpdate_(true)
+		, registry_(nullptr)
+		, revision_(1)
+		, stream_(std::make_shared<ParticleStream>())
+		, batches_()
 	{
+		for (ParticleBatch& batch : batches_)
+		{
+			batch.stream = stream_;
+		}
 	}
 
 	void ParticleNode::addParticle(sf::Vector2f position)
 	{
-		Particle particle;
+		const ParticleData& data = TABLE[toIndex(type_)];
+		if (count_ == particles_.size() || (registry_ && !registry_->reserveParticle()))
+		{
+			return;
+		}
+
+		Particle& particle = particles_[(head_ + count_) % particles_.size()];
 		particle.position = position;
-		particle.color = TABLE.at(type_).color;
-		particle.lifetime = TABLE.at(type_).lifetime;
+		particle.color = data.color;
+		particle.birth = elapsedTime_;
+		particle.lifetime = registry_ ? data.lifetime * registry_->getLifetimeScale() : data.lifetime;
 
-		particles_.push_back(particle);
+		count_++;
+	}
+
+	std::size_t ParticleNode::getParticleCount() const
+	{
+		return count_;
+	}
+
+	void ParticleNode::setRegistry(ParticleRegistry* registry)
+	{
+		registry_ = registry;
+	}
+
+	float ParticleNode::getEmissionRate(sf::Vector2f position) const
+	{
+		float rate = TABLE[toIndex(type_)].emissionRate;
+		return registry_ ? rate * registry_->getEmissionScale(position) : rate;
 	}
 
 	Particle::Type ParticleNode::getParticleType() const
@@ -67,68 +195,78 @@ namespace GEX
 		return Category::ParticleSystem;
 	}
 
+	void ParticleNode::setVertexBuffers(bool enabled)
+	{
+		vertexBuffers_ = enabled;
+	}
+
+	bool ParticleNode::isUsingVertexBuffers()
+	{
+		return vertexBuffers_;
+	}
+
 	void ParticleNode::updateCurrent(sf::Time dt, CommandQueue & commands)
 	{
-		// Remove aged out particles
-		while (!particles_.empty() && particles_.front().lifetime <= sf::Time::Zero)
-		{
-			particles_.pop_front();
-		}
+		elapsedTime_ += dt;
 
-		// count down lifetime
-		for (auto& p : particles_)
+		// Remove aged out particles, only the head moves
+		while (count_ > 0)
 		{
-			p.lifetime -= dt;
+			const Particle& oldest = particles_[head_];
+			if (elapsedTime_ - oldest.birth < oldest.lifetime)
+			{
+				break;
+			}
+
+			head_ = (head_ + 1) % particles_.size();
+			count_--;
 		}
 
-		// Mark for update
-		needsVertexUpdate_ = true;
+		// The quads of every slot are out of date
+		revision_++;
 	}
 
-	void ParticleNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void ParticleNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
-		if (needsVertexUpdate_)
+		// Frames drawn between two ticks record the same quads without rebuilding them
+		ParticleBatch& batch = batches_[target.getSlot()];
+		if (batch.revision != revision_)
 		{
-			computeVertices();
-			needsVertexUpdate_ = false;
+			computeVertices(batch.vertices);
+			batch.revision = revision_;
 		}
 
 		states.texture = &texture_;
 
 		// Draw all the verticies
-		target.draw(vertexArray_, states);
-	}
-
-	void ParticleNode::addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const
-	{
-		sf::Vertex vertex;
-		vertex.position = sf::Vector2f(worldX, worldY);
-		vertex.texCoords = sf::Vector2f(texCoordU, texCoordV);
-		vertex.color = color;
-
-		vertexArray_.append(vertex);
-
+		target.drawStored(batch, states);
 	}
 
-	void ParticleNode::computeVertices() const
+	void ParticleNode::computeVertices(std::vector<sf::Vertex>& vertices) const
 	{
 		sf::Vector2f size(texture_.getSize());
 		sf::Vector2f half = size / 2.f;
-
 		// Refill vertex array
-		vertexArray_.clear();
-		for (auto& p : particles_)
+		vertices.clear();
+		for (std::size_t i = 0; i < count_; ++i)
 		{
+			const Particle& p = particles_[(head_ + i) % particles_.size()];
+
+			// A younger particle with a shorter lifetime may be gone before the head
+			float ratio = 1.f - (elapsedTime_ - p.birth) / p.lifetime;
+			if (ratio <= 0.f)
+			{
+				continue;
+			}
+
 			sf::Vector2f pos = p.position;
 			sf::Color color = p.color;
+			color.a = static_cast<sf::Uint8>(255 * ratio);
 
-			float ratio = p.lifetime.asSeconds() / TABLE.at(type_).lifetime.asSeconds();
-			color.a = static_cast<sf::Uint8>(255 * std::max(ratio, 0.f));
-
-			addVertex(pos.x - half.x, pos.y - half.y, 0.f, 0.f, color);
-			addVertex(pos.x + half.x, pos.y - half.y, size.x, 0.f, color);
-			addVertex(pos.x + half.x, pos.y + half.y, size.x, size.y, color);
-			addVertex(pos.x - half.x, pos.y + half.y, 0.f, size.y, color);
+			vertices.push_back(sf::Vertex(sf::Vector2f(pos.x - half.x, pos.y - half.y), color, sf::Vector2f(0.f, 0.f)));
+			vertices.push_back(sf::Vertex(sf::Vector2f(pos.x + half.x, pos.y - half.y), color, sf::Vector2f(size.x, 0.f)));
+			vertices.push_back(sf::Vertex(sf::Vector2f(pos.x + half.x, pos.y + half.y), color, sf::Vector2f(size.x, size.y)));
+			vertices.push_back(sf::Vertex(sf::Vector2f(pos.x - half.x, pos.y + half.y), color, sf::Vector2f(0.f, size.y)));
 		}
 	}
 
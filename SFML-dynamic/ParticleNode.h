@@ -30,35 +30,75 @@
 #pragma once
 #include "SceneNode.h"
 #include "Particle.h"
-#include <deque>
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include "TextureManager.h"
+#include <array>
+#include <memory>
+#include <vector>
 
 namespace GEX
 {
+	class ParticleStream;
+	class ParticleRegistry;
+
 	class ParticleNode : public SceneNode
 	{
 	public:
 		ParticleNode(Particle::Type type, GEX::TextureManager& textures);
 
-		void					addParticle(sf::Vector2f position);
+		void					addParticle(sf::Vector2f position);	//dropped when over budget
 		Particle::Type			getParticleType() const;
+		std::size_t				getParticleCount() const;
+
+		void					setRegistry(ParticleRegistry* registry);
+		float					getEmissionRate(sf::Vector2f position) const;	//per emitter, after level of detail
 		unsigned int			getCategory() const override;
 
+		// false draws plain vertex arrays, as without vertex buffer support, to compare both
+		// Set before the render thread starts, it still falls back when buffers are not available
+		static void				setVertexBuffers(bool enabled);
+		static bool				isUsingVertexBuffers();
+
 	private:
 		void					updateCurrent(sf::Time dt, CommandQueue& commands) override;
-		void					drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void					drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
-		void					addVertex(float worldX, float worldY, float texCoordU, float texCoordV, const sf::Color color) const;
-		void					computeVertices() const;
+		void					computeVertices(std::vector<sf::Vertex>& vertices) const;
 
 	private:
-		std::deque<Particle>	particles_;
+		// What a snapshot records for the node, the quads of one revision and the shared stream
+		// One per snapshot slot, so the quads replayed are never the ones being rebuilt
+		class ParticleBatch : public sf::Drawable
+		{
+		public:
+									ParticleBatch();
+
+			std::shared_ptr<ParticleStream>	stream;
+			std::vector<sf::Vertex>	vertices;
+			unsigned int			revision;
+
+		private:
+			void					draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+		};
+
+	private:
+		// Ring buffer in emission order, sized to the budget of the system
+		// Particles age by comparing their birth to elapsedTime_, the oldest expire first
+		std::vector<Particle>	particles_;
+		std::size_t				head_;
+		std::size_t				count_;
+		sf::Time				elapsedTime_;
 		const sf::Texture&		texture_;
 		Particle::Type			type_;
+		ParticleRegistry*		registry_;
+
+		unsigned int			revision_;			//changes every time the particles do
+
+		std::shared_ptr<ParticleStream>	stream_;	//GPU copy of the vertices, owned by the render thread
+		mutable std::array<ParticleBatch, RenderSnapshot::SlotCount>	batches_;
 
-		mutable sf::VertexArray vertexArray_;
-		mutable bool			needsVertexUpdate_;
+		static bool				vertexBuffers_;
 	};
 }
 
@@ -0,0 +1,177 @@
+/**
+* @file
+* ParticleRegistry
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "ParticleRegistry.h"
+#include "ParticleNode.h"
+#include "EmitterNode.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace GEX
+{
+	std::size_t ParticleRegistry::directBindings_ = 0;
+	std::size_t ParticleRegistry::finderBroadcasts_ = 0;
+
+	const std::size_t ParticleRegistry::MaxParticles = 6000;
+	const float ParticleRegistry::MinDetail = 0.25f;
+	const float ParticleRegistry::FalloffDistance = 600.f;
+
+	float ParticleRegistry::averageLoad_ = 0.f;
+	std::size_t ParticleRegistry::reportedLiveParticles_ = 0;
+	int ParticleRegistry::reportedLevelOfDetail_ = 0;
+
+	ParticleRegistry::ParticleRegistry()
+		: systems_()
+		, viewBounds_()
+		, liveParticles_(0)
+		, detail_(1.f)
+	{
+		systems_.fill(nullptr);
+	}
+
+	void ParticleRegistry::add(ParticleNode& system)
+	{
+		std::size_t index = static_cast<std::size_t>(system.getParticleType());
+		assert(systems_[index] == nullptr);
+		systems_[index] = &system;
+		system.setRegistry(this);
+	}
+
+	ParticleNode* ParticleRegistry::get(Particle::Type type) const
+	{
+		return systems_[static_cast<std::size_t>(type)];
+	}
+
+	std::unique_ptr<EmitterNode> ParticleRegistry::createEmitter(Particle::Type type) const
+	{
+		ParticleNode* system = get(type);
+		if (system)
+		{
+			directBindings_++;
+		}
+
+		return std::unique_ptr<EmitterNode>(new EmitterNode(type, system));
+	}
+
+	void ParticleRegistry::update(sf::FloatRect viewBounds)
+	{
+		viewBounds_ = viewBounds;
+
+		liveParticles_ = 0;
+		for (ParticleNode* system : systems_)
+		{
+			if (system)
+			{
+				liveParticles_ += system->getParticleCount();
+			}
+		}
+
+		// Start cutting down when half of the budget is used
+		float fill = static_cast<float>(liveParticles_) / MaxParticles;
+		float budgetDetail = fill < 0.5f ? 1.f : 1.f - (fill - 0.5f) * 2.f * (1.f - MinDetail);
+
+		// and when the simulation can not keep up with real time
+		float frameDetail = averageLoad_ <= 1.f ? 1.f : 1.f / averageLoad_;
+
+		detail_ = std::max(MinDetail, std::min(budgetDetail, frameDetail));
+
+		reportedLiveParticles_ = liveParticles_;
+		reportedLevelOfDetail_ = static_cast<int>(std::round((1.f - detail_) / (1.f - MinDetail) * 3.f));
+	}
+
+	bool ParticleRegistry::reserveParticle()
+	{
+		// Counted until the next update recounts the systems, so a burst within a tick stays in the budget
+		if (liveParticles_ >= MaxParticles)
+		{
+			return false;
+		}
+
+		liveParticles_++;
+		return true;
+	}
+
+	float ParticleRegistry::getEmissionScale(sf::Vector2f position) const
+	{
+		// Distance to the view, zero inside
+		float dx = std::max(std::max(viewBounds_.left - position.x, position.x - (viewBounds_.left + viewBounds_.width)), 0.f);
+		float dy = std::max(std::max(viewBounds_.top - position.y, position.y - (viewBounds_.top + viewBounds_.height)), 0.f);
+		float distance = std::sqrt(dx * dx + dy * dy);
+
+		float distanceScale = std::max(1.f - distance / FalloffDistance, 0.f);
+		return detail_ * distanceScale;
+	}
+
+	float ParticleRegistry::getLifetimeScale() const
+	{
+		return detail_;
+	}
+
+	void ParticleRegistry::reportWorkTime(sf::Time workTime, sf::Time simulatedTime)
+	{
+		if (simulatedTime <= sf::Time::Zero)
+		{
+			return; //a frame without a tick only recorded a snapshot
+		}
+
+		// Smoothed so a single long frame does not change the detail
+		averageLoad_ = averageLoad_ * 0.9f + (workTime / simulatedTime) * 0.1f;
+	}
+
+	std::size_t ParticleRegistry::getLiveParticles()
+	{
+		return reportedLiveParticles_;
+	}
+
+	std::size_t ParticleRegistry::getParticleBudget()
+	{
+		return MaxParticles;
+	}
+
+	int ParticleRegistry::getLevelOfDetail()
+	{
+		return reportedLevelOfDetail_;
+	}
+
+	std::size_t ParticleRegistry::getDirectBindings()
+	{
+		return directBindings_;
+	}
+
+	std::size_t ParticleRegistry::getFinderBroadcasts()
+	{
+		return finderBroadcasts_;
+	}
+
+	void ParticleRegistry::countFinderBroadcast()
+	{
+		finderBroadcasts_++;
+	}
+}
@@ -0,0 +1,93 @@
+/**
+* @file
+* ParticleRegistry
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "Particle.h"
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+#include <array>
+#include <memory>
+
+namespace GEX
+{
+	class ParticleNode;
+	class EmitterNode;
+
+	// The particle systems of a world by type, so emitters are bound when created
+	// instead of broadcasting a finder command through the scene graph
+	class ParticleRegistry
+	{
+	public:
+								ParticleRegistry();
+
+		void					add(ParticleNode& system);
+		ParticleNode*			get(Particle::Type type) const;
+
+		// The emitter is already bound to the system of its type
+		std::unique_ptr<EmitterNode>	createEmitter(Particle::Type type) const;
+
+		// Level of detail, recomputed once per tick from the live particles, the frame time and the view
+		void					update(sf::FloatRect viewBounds);
+		bool					reserveParticle();							//takes room in the global budget, false when there is none
+		float					getEmissionScale(sf::Vector2f position) const;	//less far from the view
+		float					getLifetimeScale() const;
+
+		// Time spent simulating and recording a frame, against the game time its ticks simulated
+		// Not the frame period, that includes the vsync wait, working longer than simulated lowers the detail
+		static void				reportWorkTime(sf::Time workTime, sf::Time simulatedTime);
+
+		// For the stats overlay, as of the last update
+		static std::size_t		getLiveParticles();
+		static std::size_t		getParticleBudget();
+		static int				getLevelOfDetail();	//0 is full detail
+
+		// Finder broadcasts saved by emitters bound here, and the ones still sent by unbound emitters
+		static std::size_t		getDirectBindings();
+		static std::size_t		getFinderBroadcasts();
+		static void				countFinderBroadcast();
+
+	private:
+		static const std::size_t	MaxParticles;		//all systems together
+		static const float			MinDetail;			//emission and lifetime never go below this
+		static const float			FalloffDistance;	//beyond the view, emission fades out over this
+
+		std::array<ParticleNode*, static_cast<std::size_t>(Particle::Type::ParticleCount)>	systems_;
+
+		sf::FloatRect			viewBounds_;
+		std::size_t				liveParticles_;
+		float					detail_;			//1 is full detail
+
+		static float			averageLoad_;		//work time / simulated time, 1 is just keeping up
+		static std::size_t		reportedLiveParticles_;
+		static int				reportedLevelOfDetail_;
+
+		static std::size_t		directBindings_;
+		static std::size_t		finderBroadcasts_;
+	};
+}
@@ -59,18 +59,18 @@ PauseState::~PauseState()
 }
 
 //Draw pause state - Background and texts
-void PauseState::draw()
+void PauseState::draw(GEX::RenderSnapshot& target)
 {
 	sf::RenderWindow& window = *getContext().window_;
-	window.setView(window.getDefaultView());
+	target.setView(window.getDefaultView());
 
 	sf::RectangleShape backgroundShape;
 	backgroundShape.setFillColor(sf::Color(0, 0, 0, 150));
-	backgroundShape.setSize(window.getView().getSize());
+	backgroundShape.setSize(window.getDefaultView().getSize());
 
-	window.draw(backgroundShape);
-	window.draw(pauseText_);
-	window.draw(instructionText_);
+	target.draw(backgroundShape);
+	target.draw(pauseText_);
+	target.draw(instructionText_);
 }
 
 /*
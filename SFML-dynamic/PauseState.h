@@ -36,7 +36,7 @@ public:
 	PauseState(GEX::StateStack& stack, Context context);
 	~PauseState();
 
-	void					draw() override;
+	void					draw(GEX::RenderSnapshot& target) override;
 	bool					update(sf::Time dt) override;
 	bool					handleEvent(const sf::Event& event) override;
 
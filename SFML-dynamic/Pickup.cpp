@@ -30,28 +30,44 @@
 #include "Pickup.h"
 #include "Utility.h"
 #include "DataTables.h"
+#include "RecycledMemory.h"
 
 namespace GEX
 {
 
 	namespace
 	{
-		const std::map<Pickup::Type, PickupData> TABLE = initializePickupData();
+		const PickupTable TABLE = initializePickupData();
 	}
 
 	Pickup::Pickup(Type type, const TextureManager& textures)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.get(TABLE[toIndex(type)].texture), TABLE[toIndex(type)].textureRect)
 	{
 		centerOrigin(sprite_);
 	}
 
+	void* Pickup::operator new(std::size_t size)
+	{
+		return RecycledMemory<Pickup>::allocate(size);
+	}
+
+	void Pickup::operator delete(void* memory, std::size_t size)
+	{
+		RecycledMemory<Pickup>::release(memory, size);
+	}
+
 	unsigned int Pickup::getCategory() const
 	{
 		return Category::Pickup;
 	}
 
+	DrawDepth Pickup::getDrawDepth() const
+	{
+		return DrawDepth::Pickup;
+	}
+
 	sf::FloatRect Pickup::getBoundingBox() const
 	{
 		return getWorldTransform().transformRect(sprite_.getGlobalBounds());
@@ -59,7 +75,7 @@ namespace GEX
 
 	void Pickup::apply(Aircraft & aircraft)
 	{
-		TABLE.at(type_).action(aircraft);
+		TABLE[toIndex(type_)].action(aircraft);
 	}
 
 	void Pickup::updateCurrent(sf::Time dt, CommandQueue & commands)
@@ -67,7 +83,7 @@ namespace GEX
 		Entity::updateCurrent(dt, commands);
 	}
 
-	void Pickup::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Pickup::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
 	}
@@ -51,14 +51,19 @@ namespace GEX
 		Pickup(Type type, const TextureManager& textures);
 		~Pickup() = default;
 
+		// Dropped by destroyed enemies, their memory is reused
+		static void*		operator new(std::size_t size);
+		static void			operator delete(void* memory, std::size_t size);
+
 		unsigned int		getCategory() const override;
+		DrawDepth			getDrawDepth() const override;
 		sf::FloatRect		getBoundingBox() const override;
 
 		void				apply(Aircraft& aircraft);
 	
 	private:
 		void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
-		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
 	private:
 		Type				type_;
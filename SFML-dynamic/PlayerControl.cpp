@@ -30,20 +30,42 @@
 #include "PlayerControl.h"
 #include "Aircraft.h"
 #include "Command.h"
+#include "Utility.h"
 #include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
 
 namespace GEX
 {
-	struct AircraftMover
+	// Everything the player does in a tick, sent as a single command
+	struct AircraftController
 	{
-		AircraftMover(float vx, float vy) : velocity(vx, vy) {}
+		AircraftController(sf::Vector2f velocity, bool fire, bool launchMissile) 
+			: velocity(velocity)
+			, fire(fire)
+			, launchMissile(launchMissile) 
+		{}
 
 		void	operator() (Aircraft& aircraft, sf::Time dt) const
 		{
-			aircraft.accelerate(velocity);
+			if (velocity != sf::Vector2f(0.f, 0.f))
+			{
+				aircraft.accelerate(velocity);
+			}
+			if (fire)
+			{
+				aircraft.fire();
+			}
+			if (launchMissile)
+			{
+				aircraft.launchMissile();
+			}
 		}
 
 		sf::Vector2f	velocity;
+		bool			fire;
+		bool			launchMissile;
 	};
 
 	struct AircraftRotator
@@ -58,8 +80,16 @@ namespace GEX
 		int	direction;
 	};
 
+	const float PlayerControl::PlayerSpeed = 200.f;
+
 	PlayerControl::PlayerControl()
 		:currentMissionStatus_(MissionStatus::MissionRunning)
+		, heldActions_()
+		, pendingActions_()
+		, sessionMode_(InputRecording::Mode::None)
+		, sessionPath_()
+		, sessionCount_(0)
+		, recording_()
 	{
 		// Set up bindings
 		keyBindings_[sf::Keyboard::Left] = Action::MoveLeft;
@@ -84,23 +114,145 @@ namespace GEX
 			auto found = keyBindings_.find(event.key.code);
 			if (found != keyBindings_.end() && !isRealTimeAction(found->second))
 			{
-				commands.push(actionBindings_.at(found->second));
+				pendingActions_.set(static_cast<std::size_t>(found->second));
 			}
 		}
 	}
 
 	void PlayerControl::handleRealTimeInput(CommandQueue & commands)
 		{
-		//travese all assigned keys, look up the action, generate command
-		for (auto pair : keyBindings_)
+		ActionSet actions = heldActions_ | pendingActions_;
+		pendingActions_.reset();
+
+		// A replay ignores the keyboard, the recording drives the tick
+		if (recording_.getMode() == InputRecording::Mode::Replay)
+		{
+			actions = ActionSet(recording_.next());
+		}
+		else
 		{
-			if (sf::Keyboard::isKeyPressed(pair.first) && isRealTimeAction(pair.second))
+			recording_.record(static_cast<std::uint16_t>(actions.to_ulong()));
+		}
+
+		auto isSet = [&actions](Action action) { return actions.test(static_cast<std::size_t>(action)); };
+
+		// one command for the player aircraft
+		sf::Vector2f velocity;
+		if (isSet(Action::MoveLeft))
+		{
+			velocity.x -= PlayerSpeed;
+		}
+		if (isSet(Action::MoveRight))
+		{
+			velocity.x += PlayerSpeed;
+		}
+		if (isSet(Action::MoveUp))
+		{
+			velocity.y -= PlayerSpeed;
+		}
+		if (isSet(Action::MoveDown))
+		{
+			velocity.y += PlayerSpeed;
+		}
+
+		bool fire = isSet(Action::Fire);
+		bool launchMissile = isSet(Action::LaunchMissile);
+
+		if (velocity != sf::Vector2f(0.f, 0.f) || fire || launchMissile)
+		{
+			Command command;
+			command.category = Category::PlayerAircraft;
+			command.action = derivedAction<Aircraft>(AircraftController(velocity, fire, launchMissile));
+			commands.push(command);
+		}
+
+		// the rest still have their own commands
+		for (auto& pair : actionBindings_)
+		{
+			if (isSet(pair.first))
 			{
-				commands.push(actionBindings_.at(pair.second));
+				commands.push(pair.second);
 			}
 		}
 	}
 
+	void PlayerControl::handleKeyState(const sf::Event& event)
+	{
+		if (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased)
+		{
+			auto found = keyBindings_.find(event.key.code);
+			if (found != keyBindings_.end() && isRealTimeAction(found->second))
+			{
+				heldActions_.set(static_cast<std::size_t>(found->second), event.type == sf::Event::KeyPressed);
+			}
+		}
+		else if (event.type == sf::Event::LostFocus)
+		{
+			// the key releases go to another window
+			heldActions_.reset();
+		}
+	}
+
+	void PlayerControl::recordSessions(const std::string& path)
+	{
+		sessionMode_ = InputRecording::Mode::Record;
+		sessionPath_ = path;
+		sessionCount_ = 0;
+	}
+
+	void PlayerControl::replaySessions(const std::string& path)
+	{
+		recording_.load(path);
+		sessionMode_ = InputRecording::Mode::Replay;
+		sessionPath_ = path;
+	}
+
+	void PlayerControl::beginSession()
+	{
+		pendingActions_.reset();
+
+		switch (sessionMode_)
+		{
+		case InputRecording::Mode::Record:
+		{
+			unsigned int seed = createRandomSeed();
+			recording_.startRecording(seed);
+			sessionCount_++;
+			seedRandomEngine(seed);
+			break;
+		}
+		case InputRecording::Mode::Replay:
+			recording_.startReplay();
+			seedRandomEngine(recording_.getSeed());
+			break;
+		default:
+			break;
+		}
+	}
+
+	void PlayerControl::endSession()
+	{
+		try
+		{
+			if (recording_.getMode() == InputRecording::Mode::Record)
+			{
+				std::string path = sessionCount_ > 1 ? sessionPath_ + "." + std::to_string(sessionCount_) : sessionPath_;
+				recording_.save(path);
+				std::cerr << "Recorded " << recording_.getTickCount() << " ticks to " << path << std::endl;
+			}
+			else if (recording_.getMode() == InputRecording::Mode::Replay && !recording_.isFinished())
+			{
+				std::cerr << "Replay of " << sessionPath_ << " ended before the recording" << std::endl;
+			}
+		}
+		catch (std::runtime_error& e)
+		{
+			std::cerr << e.what() << std::endl;
+		}
+
+		recording_.stop();
+	}
+
 	void PlayerControl::setMissionStatus(MissionStatus status)
 	{
 		currentMissionStatus_ = status;
@@ -131,19 +283,7 @@ namespace GEX
 
 	void PlayerControl::initializeActions()
 	{
-		const float playerSpeed = 200.f;
-
-		actionBindings_[Action::MoveLeft].action = derivedAction<Aircraft>(AircraftMover(-playerSpeed, 0.f));
-		actionBindings_[Action::MoveRight].action = derivedAction<Aircraft>(AircraftMover(playerSpeed, 0.f));
-		actionBindings_[Action::MoveUp].action = derivedAction<Aircraft>(AircraftMover(0.f, -playerSpeed));
-		actionBindings_[Action::MoveDown].action = derivedAction<Aircraft>(AircraftMover(0.f, playerSpeed));
-		actionBindings_[Action::Fire].action = derivedAction<Aircraft>(std::bind(&Aircraft::fire, std::placeholders::_1));
-		actionBindings_[Action::LaunchMissile].action = derivedAction<Aircraft>(std::bind(&Aircraft::launchMissile, std::placeholders::_1));
-
-		for (auto& pair : actionBindings_)
-		{
-			pair.second.category = Category::PlayerAircraft;
-		}
+		// Movement, fire and missiles are combined by AircraftController
 		actionBindings_[Action::EnemyRotateLeft].action = derivedAction<Aircraft>(AircraftRotator(-1.f));
 		actionBindings_[Action::EnemyRotateLeft].category = Category::EnemyAircraft;
 		actionBindings_[Action::EnemyRotateRight].action = derivedAction<Aircraft>(AircraftRotator(1.f));
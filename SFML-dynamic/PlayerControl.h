@@ -31,11 +31,14 @@
 #pragma once
 
 #include <map>
+#include <bitset>
+#include <string>
 #include <SFML/Window/Keyboard.hpp>
 #include <SFML/Window/Event.hpp>
 #include "Command.h"
 #include "CommandQueue.h"
 #include "Category.h"
+#include "InputRecording.h"
 
 namespace GEX
 {
@@ -50,6 +53,7 @@ namespace GEX
 		EnemyRotateLeft,
 		Fire,
 		LaunchMissile,
+		Count
 	};
 
 	enum class MissionStatus{
@@ -64,18 +68,43 @@ namespace GEX
 		PlayerControl();
 
 		void			handleEvent(const sf::Event& event, CommandQueue& commands);
-		void			handleRealTimeInput(CommandQueue& commands);
+		void			handleRealTimeInput(CommandQueue& commands); //once per tick
+
+		// Tracks which real time actions are held, must see every key event even when the game is paused
+		void			handleKeyState(const sf::Event& event);
+
+		// Game sessions are recorded to, or replayed from, the file until changed
+		// The first session is recorded to path, later ones to path.2, path.3... so none is overwritten
+		// The replay is loaded once here and throws if it can not be, every session replays it from the start
+		void			recordSessions(const std::string& path);
+		void			replaySessions(const std::string& path);
+
+		// Called when a game starts and ends, seeds the random engine of the session
+		void			beginSession();
+		void			endSession();
 
 		void			setMissionStatus(MissionStatus status);
 		MissionStatus	getMissionStatus() const;
 
+	private:
+		using ActionSet = std::bitset<static_cast<std::size_t>(Action::Count)>;
+
 	private:
 		void			initializeActions();
 		static bool		isRealTimeAction(Action action);
 
 	private:
+		static const float						PlayerSpeed;
+
 		std::map<sf::Keyboard::Key, Action>		keyBindings_;
-		std::map<Action, Command>				actionBindings_;
+		std::map<Action, Command>				actionBindings_;	//actions not sent to the player aircraft
 		MissionStatus							currentMissionStatus_;
+
+		ActionSet								heldActions_;		//real time actions whose key is down
+		ActionSet								pendingActions_;	//triggered by events since the last tick
+		InputRecording::Mode					sessionMode_;
+		std::string								sessionPath_;
+		unsigned int							sessionCount_;		//sessions recorded to sessionPath_
+		InputRecording							recording_;
 	};
 }
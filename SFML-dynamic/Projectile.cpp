@@ -33,34 +33,46 @@
 #include "Category.h"
 #include <memory>
 #include "EmitterNode.h"
+#include "ParticleRegistry.h"
+#include "RecycledMemory.h"
 
 namespace GEX
 {
 
 	namespace
 	{
-		const std::map<Projectile::Type, ProjectileData> TABLE = initializeProjectileData();
+		const ProjectileTable& TABLE = getProjectileTable();
 	}
 
-	Projectile::Projectile(Type type, const TextureManager & textures)
+	Projectile::Projectile(Type type, const TextureManager & textures, const ParticleRegistry* particles)
 		: Entity(1)
 		, type_(type)
-		, sprite_(textures.get(TABLE.at(type).texture), TABLE.at(type).textureRect)
+		, sprite_(textures.get(TABLE[toIndex(type)].texture), TABLE[toIndex(type)].textureRect)
 	{
 		centerOrigin(sprite_);
 
 		if (isGuided())
 		{
-			std::unique_ptr<EmitterNode> smoke(new EmitterNode(Particle::Type::Smoke));
+			std::unique_ptr<EmitterNode> smoke(particles ? particles->createEmitter(Particle::Type::Smoke) : std::unique_ptr<EmitterNode>(new EmitterNode(Particle::Type::Smoke)));
 			smoke->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
 			attachChild(std::move(smoke));
 
-			std::unique_ptr<EmitterNode> propellant(new EmitterNode(Particle::Type::Propellant));
+			std::unique_ptr<EmitterNode> propellant(particles ? particles->createEmitter(Particle::Type::Propellant) : std::unique_ptr<EmitterNode>(new EmitterNode(Particle::Type::Propellant)));
 			propellant->setPosition(0.f, Projectile::getBoundingBox().height / 2.f);
 			attachChild(std::move(propellant));
 		}
 	}
 
+	void* Projectile::operator new(std::size_t size)
+	{
+		return RecycledMemory<Projectile>::allocate(size);
+	}
+
+	void Projectile::operator delete(void* memory, std::size_t size)
+	{
+		RecycledMemory<Projectile>::release(memory, size);
+	}
+
 	unsigned int Projectile::getCategory() const
 	{
 		if (type_ == Type::EnemyBullet) {
@@ -72,14 +84,19 @@ namespace GEX
 		}
 	}
 
+	DrawDepth Projectile::getDrawDepth() const
+	{
+		return DrawDepth::Projectile;
+	}
+
 	float Projectile::getMaxSpeed() const
 	{
-		return TABLE.at(type_).speed;
+		return TABLE[toIndex(type_)].speed;
 	}
 
 	int Projectile::getDamage() const
 	{
-		return TABLE.at(type_).damage;
+		return TABLE[toIndex(type_)].damage;
 	}
 
 	bool Projectile::isGuided() const
@@ -117,7 +134,7 @@ namespace GEX
 		Entity::updateCurrent(dt, commands);
 	}
 
-	void Projectile::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void Projectile::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
 	}
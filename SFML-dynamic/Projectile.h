@@ -33,6 +33,8 @@
 #include "CommandQueue.h"
 namespace GEX
 {
+	class ParticleRegistry;
+
 	class Projectile : public Entity
 	{
 	public:
@@ -40,13 +42,19 @@ namespace GEX
 		{
 			AlliedBullet,
 			EnemyBullet,
-			Missile
+			Missile,
+			Count
 		};
 
 	public:
-		Projectile(Type type, const TextureManager& textures);
+		Projectile(Type type, const TextureManager& textures, const ParticleRegistry* particles = nullptr);
+
+		// Fired and destroyed all the time, their memory is reused
+		static void*		operator new(std::size_t size);
+		static void			operator delete(void* memory, std::size_t size);
 
 		unsigned int		getCategory() const override;
+		DrawDepth			getDrawDepth() const override;
 		//sf::FloatRect		getBoundingRect() const;
 
 		float				getMaxSpeed() const;
@@ -58,7 +66,7 @@ namespace GEX
 
 	private:
 		void				updateCurrent(sf::Time dt, CommandQueue& commands) override;
-		void				drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void				drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
 	private:
 		Type				type_;
@@ -0,0 +1,79 @@
+/**
+* @file
+* RecycledMemory
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace GEX
+{
+	// Memory of destroyed objects of one type, kept for the next one instead of going back to the heap
+	// A class opts in with its own operator new and delete forwarding here, see EmitterNode
+	// Only blocks of exactly sizeof(T) are kept, a larger derived class goes to the heap
+	template <typename T>
+	class RecycledMemory
+	{
+	public:
+		static void* allocate(std::size_t size)
+		{
+			std::vector<void*>& blocks = freeBlocks();
+			if (size != sizeof(T) || blocks.empty())
+			{
+				return ::operator new(size);
+			}
+
+			void* memory = blocks.back();
+			blocks.pop_back();
+			return memory;
+		}
+
+		static void release(void* memory, std::size_t size)
+		{
+			if (!memory)
+			{
+				return;
+			}
+
+			if (size != sizeof(T))
+			{
+				::operator delete(memory);
+				return;
+			}
+			freeBlocks().push_back(memory);
+		}
+
+	private:
+		static std::vector<void*>& freeBlocks()
+		{
+			static std::vector<void*> blocks;
+			return blocks;
+		}
+	};
+}
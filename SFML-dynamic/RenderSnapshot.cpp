@@ -0,0 +1,398 @@
+/**
+* @file
+* RenderSnapshot
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "RenderSnapshot.h"
+#include "PostEffect.h"
+#include "RenderTexturePool.h"
+#include "FontManager.h"
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace GEX
+{
+	namespace
+	{
+		// Sort key, from the most significant bits: layer 8, depth 8, blend mode 4, shader 8, texture 16, recording order 20
+		const int				LayerShift = 56;
+		const int				DepthShift = 48;
+		const int				BlendShift = 44;
+		const int				ShaderShift = 36;
+		const int				TextureShift = 20;
+		const std::uint64_t		StateMask = ((std::uint64_t(1) << 28) - 1) << TextureShift;	//blend, shader and texture
+		const std::uint32_t		SequenceMask = (1u << 20) - 1;
+		const std::size_t		MaxShaderId = (1u << 8) - 1;
+		const std::size_t		MaxTextureId = (1u << 16) - 1;
+
+		std::uint64_t getBlendId(const sf::BlendMode& mode)
+		{
+			if (mode == sf::BlendAlpha)		return 0;
+			if (mode == sf::BlendAdd)		return 1;
+			if (mode == sf::BlendMultiply)	return 2;
+			if (mode == sf::BlendNone)		return 3;
+			return 4;
+		}
+
+		// Resources are numbered in the order a snapshot first uses them
+		template <typename T>
+		std::uint64_t getResourceId(std::vector<const T*>& ids, const T* resource, std::size_t maxId)
+		{
+			if (!resource)
+			{
+				return 0;
+			}
+
+			auto found = std::find(ids.begin(), ids.end(), resource);
+			if (found != ids.end())
+			{
+				return std::min<std::size_t>(found - ids.begin() + 1, maxId);
+			}
+
+			ids.push_back(resource);
+			return std::min(ids.size(), maxId);
+		}
+
+		// LSD radix sort, one byte per pass, stable so equal keys keep the recording order
+		template <typename Item>
+		void radixSort(std::vector<Item>& items, std::vector<Item>& scratch)
+		{
+			scratch.resize(items.size());
+			for (int shift = 0; shift < 64; shift += 8)
+			{
+				std::array<std::size_t, 256> counts = {};
+				for (const Item& item : items)
+				{
+					++counts[(item.key >> shift) & 0xFF];
+				}
+
+				// Every key has the same byte, nothing to move
+				if (counts[(items.front().key >> shift) & 0xFF] == items.size())
+				{
+					continue;
+				}
+
+				std::size_t offset = 0;
+				for (std::size_t& count : counts)
+				{
+					std::size_t bucketSize = count;
+					count = offset;
+					offset += bucketSize;
+				}
+
+				for (const Item& item : items)
+				{
+					scratch[counts[(item.key >> shift) & 0xFF]++] = item;
+				}
+				items.swap(scratch);
+			}
+		}
+	}
+
+	std::size_t RenderSnapshot::stateChanges_ = 0;
+	std::size_t RenderSnapshot::unsortedStateChanges_ = 0;
+
+	RenderSnapshot::RenderSnapshot()
+		: slot_(0)
+		, arena_(64 * 1024)
+		, layers_()
+		, layerCount_(0)
+		, isSorting_(false)
+		, sortStart_(0)
+		, sortLayer_(0)
+		, sortDepth_(0)
+		, sortSequence_(0)
+		, textureIds_()
+		, shaderIds_()
+		, sortItems_()
+		, sortScratch_()
+		, sortedCommands_()
+	{
+		clear();
+	}
+
+	RenderSnapshot::~RenderSnapshot()
+	{
+		clear();
+	}
+
+	void RenderSnapshot::setSlot(std::size_t slot)
+	{
+		assert(slot < SlotCount);
+		slot_ = slot;
+	}
+
+	std::size_t RenderSnapshot::getSlot() const
+	{
+		return slot_;
+	}
+
+	void RenderSnapshot::clear()
+	{
+		// The arena only hands the memory back, the copied drawables still own theirs
+		for (std::size_t i = 0; i < layerCount_; ++i)
+		{
+			for (Command* command : layers_[i].commands)
+			{
+				command->~Command();
+			}
+			layers_[i].commands.clear();
+		}
+		arena_.reset();
+
+		layerCount_ = 0;
+		pushLayer(false);
+
+		isSorting_ = false;
+		textureIds_.clear();
+		shaderIds_.clear();
+	}
+
+	void RenderSnapshot::setView(const sf::View& view)
+	{
+		addCommand(create<ViewCommand>(view), 0, false);
+	}
+
+	void RenderSnapshot::beginPostEffect()
+	{
+		assert(!isSorting_);
+		pushLayer(true);
+	}
+
+	void RenderSnapshot::endPostEffect()
+	{
+		assert(!isSorting_);
+		pushLayer(false);
+	}
+
+	void RenderSnapshot::beginSorting()
+	{
+		assert(!isSorting_);
+		isSorting_ = true;
+		sortStart_ = getCurrentLayer().commands.size();
+		sortLayer_ = 0;
+		sortDepth_ = 0;
+		sortSequence_ = 0;
+	}
+
+	void RenderSnapshot::endSorting()
+	{
+		assert(isSorting_);
+		isSorting_ = false;
+
+		unsortedStateChanges_ = countStateChanges();
+
+		// Each run of draws between two view changes is sorted on its own
+		auto& commands = getCurrentLayer().commands;
+		std::size_t begin = sortStart_;
+		while (begin < commands.size())
+		{
+			if (!commands[begin]->isSortable)
+			{
+				++begin;
+				continue;
+			}
+
+			std::size_t end = begin;
+			while (end < commands.size() && commands[end]->isSortable)
+			{
+				++end;
+			}
+
+			sortCommands(begin, end);
+			begin = end;
+		}
+
+		stateChanges_ = countStateChanges();
+	}
+
+	void RenderSnapshot::setSortLayer(std::uint8_t layer)
+	{
+		sortLayer_ = layer;
+	}
+
+	void RenderSnapshot::setSortDepth(std::uint8_t depth)
+	{
+		sortDepth_ = depth;
+	}
+
+	std::size_t RenderSnapshot::getStateChanges()
+	{
+		return stateChanges_;
+	}
+
+	std::size_t RenderSnapshot::getUnsortedStateChanges()
+	{
+		return unsortedStateChanges_;
+	}
+
+	void RenderSnapshot::replay(sf::RenderTarget& target, PostEffect& effect) const
+	{
+		for (std::size_t i = 0; i < layerCount_; ++i)
+		{
+			const Layer& layer = layers_[i];
+			if (layer.commands.empty())
+			{
+				continue;
+			}
+
+			if (layer.hasPostEffect && PostEffect::isSupported())
+			{
+				sf::RenderTexture& sceneTexture = RenderTexturePool::getInstance().borrow(target.getSize());
+
+				sceneTexture.clear();
+				replayLayer(layer, sceneTexture);
+				sceneTexture.display();
+				effect.apply(sceneTexture, target);
+
+				RenderTexturePool::getInstance().giveBack(sceneTexture);
+			}
+			else
+			{
+				replayLayer(layer, target);
+			}
+		}
+	}
+
+	std::size_t RenderSnapshot::getCommandCount() const
+	{
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < layerCount_; ++i)
+		{
+			count += layers_[i].commands.size();
+		}
+		return count;
+	}
+
+	void RenderSnapshot::replayLayer(const Layer& layer, sf::RenderTarget& target) const
+	{
+		for (const Command* command : layer.commands)
+		{
+			command->execute(target);
+		}
+	}
+
+	void RenderSnapshot::addCommand(Command* command, std::uint64_t key, bool isSortable)
+	{
+		command->key = key;
+		command->isSortable = isSortable;
+		getCurrentLayer().commands.push_back(command);
+	}
+
+	void RenderSnapshot::pushLayer(bool hasPostEffect)
+	{
+		if (layerCount_ == layers_.size())
+		{
+			layers_.push_back(Layer{ hasPostEffect });
+		}
+		layers_[layerCount_].hasPostEffect = hasPostEffect;
+		++layerCount_;
+	}
+
+	RenderSnapshot::Layer& RenderSnapshot::getCurrentLayer()
+	{
+		return layers_[layerCount_ - 1];
+	}
+
+	void RenderSnapshot::prepareDrawable(sf::Text& text)
+	{
+		// A glyph missing from the font would be rendered to its texture now, while the render thread draws with it
+		assert(!text.getFont() || FontManager::getInstance().isPrebuilt(*text.getFont(), text.getCharacterSize()));
+		assert(std::all_of(text.getString().begin(), text.getString().end(), [](sf::Uint32 c) { return c == '\n' || c == '\t' || (c >= ' ' && c < 128); }));
+
+		// Lays out the glyph quads, the copy drawn later only reads them
+		text.getLocalBounds();
+	}
+
+	std::uint64_t RenderSnapshot::makeSortKey(const sf::Texture* texture, const sf::RenderStates& states)
+	{
+		return (std::uint64_t(sortLayer_) << LayerShift)
+			| (std::uint64_t(sortDepth_) << DepthShift)
+			| (getBlendId(states.blendMode) << BlendShift)
+			| (getResourceId(shaderIds_, states.shader, MaxShaderId) << ShaderShift)
+			| (getResourceId(textureIds_, texture, MaxTextureId) << TextureShift)
+			| (sortSequence_++ & SequenceMask);
+	}
+
+	void RenderSnapshot::sortCommands(std::size_t begin, std::size_t end)
+	{
+		auto& commands = getCurrentLayer().commands;
+
+		sortItems_.clear();
+		for (std::size_t i = begin; i < end; ++i)
+		{
+			sortItems_.push_back({ commands[i]->key, i });
+		}
+
+		radixSort(sortItems_, sortScratch_);
+
+		sortedCommands_.clear();
+		for (const SortItem& item : sortItems_)
+		{
+			sortedCommands_.push_back(commands[item.index]);
+		}
+		std::copy(sortedCommands_.begin(), sortedCommands_.end(), commands.begin() + begin);
+		sortedCommands_.clear();
+	}
+
+	std::size_t RenderSnapshot::countStateChanges() const
+	{
+		const auto& commands = layers_[layerCount_ - 1].commands;
+
+		std::size_t changes = 0;
+		bool isFirst = true;
+		std::uint64_t previousState = 0;
+		for (std::size_t i = sortStart_; i < commands.size(); ++i)
+		{
+			if (!commands[i]->isSortable)
+			{
+				continue;
+			}
+
+			std::uint64_t state = commands[i]->key & StateMask;
+			if (!isFirst && state != previousState)
+			{
+				++changes;
+			}
+			previousState = state;
+			isFirst = false;
+		}
+		return changes;
+	}
+
+	RenderSnapshot::ViewCommand::ViewCommand(const sf::View& view)
+		: view(view)
+	{}
+
+	void RenderSnapshot::ViewCommand::execute(sf::RenderTarget& target) const
+	{
+		target.setView(view);
+	}
+}
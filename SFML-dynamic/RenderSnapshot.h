@@ -0,0 +1,267 @@
+/**
+* @file
+* RenderSnapshot
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include "FrameArena.h"
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace sf
+{
+	class RenderTarget;
+	class Text;
+}
+
+namespace GEX
+{
+	class PostEffect;
+
+	// Everything one frame draws, recorded by the simulation and replayed by the render thread.
+	// Drawables are copied when recorded so the scene can keep changing while the copy is drawn.
+	// Commands live in an arena of the snapshot, recording a frame the size of the last one does not allocate
+	class RenderSnapshot : private sf::NonCopyable
+	{
+	public:
+		// Snapshots are double buffered, one is recorded while the other is replayed
+		static const std::size_t	SlotCount = 2;
+
+	public:
+								RenderSnapshot();
+								~RenderSnapshot();
+
+		void					setSlot(std::size_t slot);
+		std::size_t				getSlot() const;
+
+		void					clear();
+
+		void					setView(const sf::View& view);
+
+		// Takes the drawable by value, pass temporaries to avoid a second copy
+		template <typename T>
+		void					draw(T drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+		// Not copied, the drawable must stay unchanged until the snapshot of the same slot is recorded again
+		// Nodes with large vertex arrays keep one per slot, so the array replayed is never the one being written
+		template <typename T>
+		void					drawStored(const T& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+		// Commands between begin and end are drawn to a scene texture and run through the effect
+		void					beginPostEffect();
+		void					endPostEffect();
+
+		// Draws between begin and end are ordered by sort key instead of recording order:
+		// layer, depth, blend mode, shader, texture, then recording order. A view change keeps the draws on each side apart
+		// Only draws of the same layer and depth are reordered by state, so overlapping kinds of draws keep their order
+		void					beginSorting();
+		void					endSorting();
+		void					setSortLayer(std::uint8_t layer);	//draws of a lower layer stay below
+		void					setSortDepth(std::uint8_t depth);	//within a layer, draws of a lower depth stay below
+
+		// For the stats overlay, texture, shader or blend mode changes between consecutive draws
+		// of the last sorted range, and how many the recording order had
+		static std::size_t		getStateChanges();
+		static std::size_t		getUnsortedStateChanges();
+
+		// The scene texture of a post effect layer is borrowed from the RenderTexturePool
+		void					replay(sf::RenderTarget& target, PostEffect& effect) const;
+
+		std::size_t				getCommandCount() const;
+
+	private:
+		struct Command
+		{
+								Command() : key(0), isSortable(false) {}
+			virtual				~Command() = default;
+			virtual void		execute(sf::RenderTarget& target) const = 0;
+
+			std::uint64_t		key;
+			bool				isSortable;	//draws recorded while sorting
+		};
+
+		template <typename T>
+		struct DrawCommand : public Command
+		{
+								DrawCommand(T&& drawable, const sf::RenderStates& states);
+			void				execute(sf::RenderTarget& target) const override;
+
+			T					drawable;
+			sf::RenderStates	states;
+		};
+
+		template <typename T>
+		struct StoredDrawCommand : public Command
+		{
+								StoredDrawCommand(const T& drawable, const sf::RenderStates& states);
+			void				execute(sf::RenderTarget& target) const override;
+
+			const T*			drawable;
+			sf::RenderStates	states;
+		};
+
+		struct ViewCommand : public Command
+		{
+			explicit			ViewCommand(const sf::View& view);
+			void				execute(sf::RenderTarget& target) const override;
+
+			sf::View			view;
+		};
+
+		struct Layer
+		{
+			bool					hasPostEffect;
+			std::vector<Command*>	commands;	//in the arena
+		};
+
+		struct SortItem
+		{
+			std::uint64_t		key;
+			std::size_t			index;
+		};
+
+	private:
+		template <typename C, typename... Args>
+		C*						create(Args&&... args);
+		void					addCommand(Command* command, std::uint64_t key, bool isSortable);
+		void					pushLayer(bool hasPostEffect);
+		Layer&					getCurrentLayer();
+
+		void					replayLayer(const Layer& layer, sf::RenderTarget& target) const;
+
+		// Geometry built lazily must be built while recording, on the simulation thread
+		// Text must use glyphs prebuilt by the FontManager, so the font texture never changes and the copy
+		// replayed on the render thread keeps its geometry instead of laying it out again
+		template <typename T>
+		static void				prepareDrawable(T& drawable) {}
+		static void				prepareDrawable(sf::Text& text);
+
+		// Sprites and animations carry their texture, other drawables get it from the states
+		template <typename T>
+		static auto				getDrawTexture(const T& drawable, const sf::RenderStates& states, int) -> decltype(drawable.getTexture());
+		template <typename T>
+		static const sf::Texture*	getDrawTexture(const T& drawable, const sf::RenderStates& states, long);
+
+		std::uint64_t			makeSortKey(const sf::Texture* texture, const sf::RenderStates& states);
+		void					sortCommands(std::size_t begin, std::size_t end);
+		std::size_t				countStateChanges() const;
+
+	private:
+		std::size_t				slot_;
+		FrameArena				arena_;
+		std::vector<Layer>		layers_;		//kept with their capacity, only the first layerCount_ are in use
+		std::size_t				layerCount_;
+
+		bool								isSorting_;
+		std::size_t							sortStart_;		//first command of the sorted range in the last layer
+		std::uint8_t						sortLayer_;
+		std::uint8_t						sortDepth_;
+		std::uint32_t						sortSequence_;
+		std::vector<const sf::Texture*>		textureIds_;	//id is the index + 1, 0 is no texture
+		std::vector<const sf::Shader*>		shaderIds_;
+		std::vector<SortItem>				sortItems_;
+		std::vector<SortItem>				sortScratch_;
+		std::vector<Command*>				sortedCommands_;
+
+		static std::size_t					stateChanges_;
+		static std::size_t					unsortedStateChanges_;
+	};
+
+	template <typename T>
+	void RenderSnapshot::draw(T drawable, const sf::RenderStates& states)
+	{
+		std::uint64_t key = 0;
+		if (isSorting_)
+		{
+			key = makeSortKey(getDrawTexture(drawable, states, 0), states);
+		}
+
+		prepareDrawable(drawable);
+
+		addCommand(create<DrawCommand<T>>(std::move(drawable), states), key, isSorting_);
+	}
+
+	template <typename T>
+	void RenderSnapshot::drawStored(const T& drawable, const sf::RenderStates& states)
+	{
+		std::uint64_t key = 0;
+		if (isSorting_)
+		{
+			key = makeSortKey(getDrawTexture(drawable, states, 0), states);
+		}
+
+		addCommand(create<StoredDrawCommand<T>>(drawable, states), key, isSorting_);
+	}
+
+	template <typename C, typename... Args>
+	C* RenderSnapshot::create(Args&&... args)
+	{
+		void* memory = arena_.allocate(sizeof(C), alignof(C));
+		return new (memory) C(std::forward<Args>(args)...);
+	}
+
+	template <typename T>
+	auto RenderSnapshot::getDrawTexture(const T& drawable, const sf::RenderStates& states, int) -> decltype(drawable.getTexture())
+	{
+		return drawable.getTexture() ? drawable.getTexture() : states.texture;
+	}
+
+	template <typename T>
+	const sf::Texture* RenderSnapshot::getDrawTexture(const T& drawable, const sf::RenderStates& states, long)
+	{
+		return states.texture;
+	}
+
+	template <typename T>
+	RenderSnapshot::DrawCommand<T>::DrawCommand(T&& drawable, const sf::RenderStates& states)
+		: drawable(std::move(drawable))
+		, states(states)
+	{}
+
+	template <typename T>
+	void RenderSnapshot::DrawCommand<T>::execute(sf::RenderTarget& target) const
+	{
+		target.draw(drawable, states);
+	}
+
+	template <typename T>
+	RenderSnapshot::StoredDrawCommand<T>::StoredDrawCommand(const T& drawable, const sf::RenderStates& states)
+		: drawable(&drawable)
+		, states(states)
+	{}
+
+	template <typename T>
+	void RenderSnapshot::StoredDrawCommand<T>::execute(sf::RenderTarget& target) const
+	{
+		target.draw(*drawable, states);
+	}
+}
\ No newline at end of file
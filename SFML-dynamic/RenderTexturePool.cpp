@@ -0,0 +1,97 @@
+/**
+* @file
+* RenderTexturePool.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "RenderTexturePool.h"
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+namespace GEX
+{
+	RenderTexturePool* RenderTexturePool::instance_ = nullptr;
+
+	RenderTexturePool& RenderTexturePool::getInstance()
+	{
+		if (!instance_)
+		{
+			RenderTexturePool::instance_ = new RenderTexturePool();
+		}
+
+		return *RenderTexturePool::instance_;
+	}
+
+	sf::RenderTexture& RenderTexturePool::borrow(sf::Vector2u size, bool smooth)
+	{
+		for (Entry& entry : textures_)
+		{
+			if (!entry.isBorrowed && entry.size == size && entry.smooth == smooth)
+			{
+				entry.isBorrowed = true;
+				return *entry.texture;
+			}
+		}
+
+		// After a resize the old sizes are never borrowed again, do not keep their framebuffers
+		textures_.erase(std::remove_if(textures_.begin(), textures_.end(), [size](const Entry& entry)
+		{
+			return !entry.isBorrowed && entry.size != size;
+		}), textures_.end());
+
+		std::unique_ptr<sf::RenderTexture> texture(new sf::RenderTexture());
+		if (!texture->create(size.x, size.y))
+		{
+			throw std::runtime_error("RenderTexture create failed: " + std::to_string(size.x) + "x" + std::to_string(size.y));
+		}
+		texture->setSmooth(smooth);
+
+		textures_.push_back(Entry{ size, smooth, true, std::move(texture) });
+		return *textures_.back().texture;
+	}
+
+	void RenderTexturePool::giveBack(const sf::RenderTexture& texture)
+	{
+		for (Entry& entry : textures_)
+		{
+			if (entry.texture.get() == &texture)
+			{
+				assert(entry.isBorrowed);
+				entry.isBorrowed = false;
+				return;
+			}
+		}
+
+		assert(!"Not borrowed from the pool");
+	}
+
+	std::size_t RenderTexturePool::getTextureCount() const
+	{
+		return textures_.size();
+	}
+}
@@ -0,0 +1,69 @@
+/**
+* @file
+* RenderTexturePool.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <memory>
+#include <vector>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace GEX
+{
+	// Render textures shared by the whole process, by size and smoothing
+	// A borrowed texture stays owned by the pool and must be given back,
+	// so borrowing the same size again does not allocate a new framebuffer
+	// Only used by the render thread
+	class RenderTexturePool
+	{
+	private:
+		RenderTexturePool() = default;
+
+	public:
+		static RenderTexturePool&			getInstance();
+
+		// The contents are whatever the last borrower left
+		// A size not in the pool means the sizes in use changed, the idle textures of other sizes are dropped
+		sf::RenderTexture&					borrow(sf::Vector2u size, bool smooth = false);
+		void								giveBack(const sf::RenderTexture& texture);
+
+		std::size_t							getTextureCount() const;
+
+	private:
+		struct Entry
+		{
+			sf::Vector2u						size;
+			bool								smooth;
+			bool								isBorrowed;
+			std::unique_ptr<sf::RenderTexture>	texture;
+		};
+
+	private:
+		static RenderTexturePool*			instance_;
+		std::vector<Entry>					textures_;
+	};
+}
@@ -44,11 +44,26 @@ namespace GEX
 		FinishLine
 	};
 
+	enum class AnimationID
+	{
+		Explosion,
+		Count
+	};
+
 	enum class FontID
 	{
 		Main
 	};
 
+	enum class ShaderID
+	{
+		BrightnessPass,
+		DownSamplePass,
+		GaussianBlurPass,
+		AddPass,
+		Count
+	};
+
 	enum class MusicID
 	{
 		MenuTheme,
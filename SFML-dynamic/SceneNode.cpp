@@ -31,16 +31,24 @@
 #include <cassert>
 #include "Command.h"
 #include "Utility.h"
-#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <functional>
 
 namespace GEX
 {
+	float SceneNode::renderInterpolation_ = 1.f;
+	unsigned int SceneNode::tick_ = 0;
+
 	SceneNode::SceneNode(Category::Type category)
 		: children_()
 		, parent_(nullptr)
 		, category_(category)
+		, indexInParent_(0)
+		, traversalIndex_(0)
+		, isQueuedForRemoval_(false)
+		, previousPosition_()
+		, previousRotation_(0.f)
+		, hasPreviousState_(false)
 	{
 
 	}
@@ -48,27 +56,78 @@ namespace GEX
 	void SceneNode::attachChild(Ptr child)
 	{
 		child->parent_ = this;
+		child->indexInParent_ = children_.size();
 		children_.push_back(std::move(child));
+
+		appendToTraversal(*children_.back());
 	}
 
 	SceneNode::Ptr SceneNode::detachChild(const SceneNode & node)
 	{
-		auto found = std::find_if(children_.begin(), children_.end(), [&](Ptr& p) {
-			return &node == p.get();
-		});
-		assert(found != children_.end());
-		if (found != children_.end()) {
-			Ptr result = std::move(*found);
-			children_.erase(found);
-			return result;
+		assert(node.parent_ == this && children_[node.indexInParent_].get() == &node);
+
+		std::size_t index = node.indexInParent_;
+		Ptr result = std::move(children_[index]);
+		children_.erase(children_.begin() + index);
+		for (std::size_t i = index; i < children_.size(); ++i)
+		{
+			children_[i]->indexInParent_ = i;
 		}
-		return nullptr;
+
+		result->parent_ = nullptr;
+
+		removeFromTraversal(*result);
+		return result;
+	}
+
+	SceneNode* SceneNode::getParent() const
+	{
+		return parent_;
 	}
 
 	void SceneNode::update(sf::Time dt, CommandQueue& commands)
 	{
+		rememberState();
+
 		updateCurrent(dt, commands);
 		updateChildren(dt, commands);
+
+		checkRemoval();
+	}
+
+	void SceneNode::rememberState()
+	{
+		// Remember where the node was, drawing interpolates from here
+		previousPosition_ = getPosition();
+		previousRotation_ = getRotation();
+		hasPreviousState_ = true;
+	}
+
+	void SceneNode::compactChildren()
+	{
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < children_.size(); ++i)
+		{
+			if (children_[i])
+			{
+				if (i != count)
+				{
+					children_[count] = std::move(children_[i]);
+				}
+				children_[count]->indexInParent_ = count;
+				++count;
+			}
+		}
+		children_.resize(count);
+	}
+
+	void SceneNode::checkRemoval()
+	{
+		if (!isQueuedForRemoval_ && isMarkedForRemoval())
+		{
+			isQueuedForRemoval_ = true;
+			queueRemoval(*this);
+		}
 	}
 
 	void SceneNode::onCommand(const Command & command, sf::Time dt)
@@ -108,26 +167,71 @@ namespace GEX
 		return transform;
 	}
 
-	sf::FloatRect SceneNode::getBoundingBox() const
+	void SceneNode::setRenderInterpolation(float alpha)
 	{
-		return sf::FloatRect();
+		renderInterpolation_ = std::max(0.f, std::min(alpha, 1.f));
 	}
 
-	void SceneNode::drawBoundingBox(sf::RenderTarget & target, sf::RenderStates states) const
+	float SceneNode::getRenderInterpolation()
 	{
-		sf::FloatRect rect = getBoundingBox();
+		return renderInterpolation_;
+	}
 
-		sf::RectangleShape box;
-		box.setPosition(sf::Vector2f(rect.left, rect.top));
-		box.setSize(sf::Vector2f(rect.width, rect.height));
-		box.setFillColor(sf::Color::Transparent);
-		box.setOutlineColor(sf::Color::Cyan);
-		box.setOutlineThickness(1.f);
+	void SceneNode::advanceTick()
+	{
+		++tick_;
+	}
 
-		//target.draw(box);
+	unsigned int SceneNode::getTick()
+	{
+		return tick_;
 	}
 
-	void SceneNode::checkSceneCollision(SceneNode & rootNode, std::set<Pair>& collisionPair)
+	sf::Transform SceneNode::getInterpolatedTransform() const
+	{
+		if (!hasPreviousState_ || renderInterpolation_ >= 1.f)
+		{
+			return getTransform();
+		}
+
+		sf::Vector2f position = getPosition();
+		float rotation = getRotation();
+		if (position == previousPosition_ && rotation == previousRotation_)
+		{
+			return getTransform();
+		}
+
+		// Rotate the short way around
+		float deltaRotation = rotation - previousRotation_;
+		if (deltaRotation > 180.f)
+		{
+			deltaRotation -= 360.f;
+		}
+		else if (deltaRotation < -180.f)
+		{
+			deltaRotation += 360.f;
+		}
+
+		sf::Transformable interpolated;
+		interpolated.setOrigin(getOrigin());
+		interpolated.setScale(getScale());
+		interpolated.setPosition(previousPosition_ + (position - previousPosition_) * renderInterpolation_);
+		interpolated.setRotation(previousRotation_ + deltaRotation * renderInterpolation_);
+
+		return interpolated.getTransform();
+	}
+
+	sf::FloatRect SceneNode::getBoundingBox() const
+	{
+		return sf::FloatRect();
+	}
+
+	DrawDepth SceneNode::getDrawDepth() const
+	{
+		return DrawDepth::Default;
+	}
+
+	void SceneNode::checkSceneCollision(SceneNode & rootNode, PairList& collisionPair)
 	{
 		checkNodeCollision(rootNode, collisionPair);
 		for (Ptr& child : rootNode.children_)
@@ -136,11 +240,11 @@ namespace GEX
 		}
 	}
 
-	void SceneNode::checkNodeCollision(SceneNode & node, std::set<Pair>& collisionPair)
+	void SceneNode::checkNodeCollision(SceneNode & node, PairList& collisionPair)
 	{
 		if (this != &node && collision(*this, node) && !isDestroyed() && !node.isDestroyed())
 		{
-			collisionPair.insert(std::minmax(this, &node));
+			collisionPair.push_back(std::minmax(this, &node));
 		}
 
 		for (Ptr& c : children_)
@@ -159,12 +263,28 @@ namespace GEX
 		return isDestroyed();
 	}
 
-	void SceneNode::removeWrecks()
+	void SceneNode::queueRemoval(SceneNode& node)
+	{
+		if (parent_)
+		{
+			parent_->queueRemoval(node);
+		}
+	}
+
+	void SceneNode::appendToTraversal(SceneNode& child)
 	{
-		auto wreckfieldBegin = std::remove_if(children_.begin(), children_.end(), std::mem_fn(&SceneNode::isMarkedForRemoval));
-		children_.erase(wreckfieldBegin, children_.end());
+		if (parent_)
+		{
+			parent_->appendToTraversal(child);
+		}
+	}
 
-		std::for_each(children_.begin(), children_.end(), std::mem_fn(&SceneNode::removeWrecks));
+	void SceneNode::removeFromTraversal(const SceneNode& child)
+	{
+		if (parent_)
+		{
+			parent_->removeFromTraversal(child);
+		}
 	}
 
 	void SceneNode::updateCurrent(sf::Time dt, CommandQueue& commands)
@@ -180,23 +300,22 @@ namespace GEX
 		}
 	}
 
-	void SceneNode::draw(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::draw(RenderSnapshot& target, sf::RenderStates states) const
 	{
-		states.transform *= getTransform();
+		states.transform *= getInterpolatedTransform();
 
+		target.setSortDepth(static_cast<std::uint8_t>(getDrawDepth()));
 		drawCurrent(target, states);
 		drawChildren(target, states);
-
-		drawBoundingBox(target, states);
 	}
 
-	void SceneNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
 		// no default
 		// must be overwrite
 	}
 
-	void SceneNode::drawChildren(sf::RenderTarget & target, sf::RenderStates states) const
+	void SceneNode::drawChildren(RenderSnapshot& target, sf::RenderStates states) const
 	{	
 		/*
 		for (auto i = children_.begin(); i != children_.end(); ++i)
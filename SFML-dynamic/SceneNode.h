@@ -32,9 +32,10 @@
 #pragma once
 
 #include <SFML\Graphics\Transformable.hpp>
-#include <SFML\Graphics\Drawable.hpp>
 #include <SFML\System\Time.hpp>
 #include "Category.h"
+#include "RenderSnapshot.h"
+#include "FrameArena.h"
 #include <set>
 
 #include <vector>
@@ -46,12 +47,24 @@ namespace GEX
 	class CommandQueue;
 	struct Command;
 
-	class SceneNode : public sf::Transformable, public sf::Drawable
+	// Kinds of draws of one scene layer, from the bottom up, see RenderSnapshot::setSortDepth
+	// The draws of one kind are batched by texture, a higher kind is drawn over them whatever its texture
+	enum class DrawDepth : std::uint8_t
+	{
+		Default,
+		Aircraft,
+		Pickup,
+		Projectile,
+		Explosion
+	};
+
+	class SceneNode : public sf::Transformable
 	{
 	public:
 		//typedef std::unique_ptr<SceneNode> Ptr;
 		using Ptr = std::unique_ptr<SceneNode>;
 		using Pair = std::pair<SceneNode*, SceneNode*>;
+		using PairList = FrameVector<Pair>;	//may hold a pair twice, once from each node
 
 	public:
 		SceneNode(Category::Type category = Category::Type::None);
@@ -60,40 +73,76 @@ namespace GEX
 		SceneNode&				operator=(SceneNode&) = delete;
 
 		void					attachChild(Ptr child);
-		SceneNode::Ptr			detachChild(const SceneNode& ptr);
+		SceneNode::Ptr			detachChild(const SceneNode& ptr);	//the later siblings move up, drawing order is sibling order
+		SceneNode*				getParent() const;
 								
-		void					update(sf::Time dt, CommandQueue& commands);
-		void					onCommand(const Command& command, sf::Time dt);
+		// Virtual so a root can walk its tree its own way, see SceneRoot
+		virtual void			update(sf::Time dt, CommandQueue& commands);
+		virtual void			onCommand(const Command& command, sf::Time dt);
 		virtual unsigned int	getCategory() const;
 
+		// Record the tree into the snapshot the render thread draws
+		virtual void			draw(RenderSnapshot& target, sf::RenderStates states) const;
+
 		sf::Vector2f			getWorldPosition() const;
 		sf::Transform			getWorldTransform() const;
 
-		virtual sf::FloatRect	getBoundingBox() const;
-		void					drawBoundingBox(sf::RenderTarget& target, sf::RenderStates states) const;
+		// How far the frame being drawn is between the previous update and the last one [0, 1]
+		static void				setRenderInterpolation(float alpha);
+		static float			getRenderInterpolation();
+		sf::Transform			getInterpolatedTransform() const;
 
-		void					checkSceneCollision(SceneNode& rootNode, std::set<Pair>& collisionPair);
-		void					checkNodeCollision(SceneNode& node, std::set<Pair>& collisionPair);
+		// Counts the simulation ticks, a tree not updated in the last one is drawn as it is
+		static void				advanceTick();
+		static unsigned int		getTick();
+
+		virtual sf::FloatRect	getBoundingBox() const;	//world coordinates, see DebugDrawNode to show them
+		virtual DrawDepth		getDrawDepth() const;
+
+		void					checkSceneCollision(SceneNode& rootNode, PairList& collisionPair);
+		void					checkNodeCollision(SceneNode& node, PairList& collisionPair);
 
 		virtual bool			isDestroyed() const;
 		virtual bool			isMarkedForRemoval() const;
-		void					removeWrecks();
+
+	private:
+		friend class SceneRoot;	//walks the tree in depth-first order without recursion
+
+		void					rememberState();	//start of the update, drawing interpolates from there
+		void					checkRemoval();		//end of the update, after the children
+		void					compactChildren();	//drops the released children, the others keep their order
 
 	private:
 		SceneNode*				parent_;
 		std::vector<Ptr>		children_;
+		std::size_t				indexInParent_;
+		std::size_t				traversalIndex_;	//in the flat traversal of the root, see SceneRoot
+		bool					isQueuedForRemoval_;
 
 		Category::Type			category_;
 
+		sf::Vector2f			previousPosition_;
+		float					previousRotation_;
+		bool					hasPreviousState_;
+
+		static float			renderInterpolation_;
+		static unsigned int		tick_;
+
 	protected:
 		// Update the tree
 		virtual void			updateCurrent(sf::Time dt, CommandQueue& commands);
 		void					updateChildren(sf::Time dt, CommandQueue& commands);
 
+		// A node marked for removal hands itself up the tree to the root, see SceneRoot
+		virtual void			queueRemoval(SceneNode& node);
+
+		// Attaching or detaching a child hands the change up to the root, see SceneRoot
+		virtual void			appendToTraversal(SceneNode& child);
+		virtual void			removeFromTraversal(const SceneNode& child);
+
 		//draw the tree
-		void					draw(sf::RenderTarget& target, sf::RenderStates states) const override;
-		virtual void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const;
-		void					drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
+		virtual void			drawCurrent(RenderSnapshot& target, sf::RenderStates states) const;
+		void					drawChildren(RenderSnapshot& target, sf::RenderStates states) const;
 	};
 
 	float distance(const SceneNode& lhs, const SceneNode& rhs);
@@ -0,0 +1,359 @@
+/**
+* @file
+* SceneRoot.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "SceneRoot.h"
+#include "Command.h"
+#include <cassert>
+
+namespace GEX
+{
+	bool SceneRoot::flatTraversal_ = true;
+	std::size_t SceneRoot::nodeCount_ = 0;
+	std::size_t SceneRoot::rebuildCount_ = 0;
+
+	SceneRoot::SceneRoot()
+		: SceneNode()
+		, wrecks_()
+		, releasedWrecks_()
+		, wreckParents_()
+		, debugDraw_(nullptr)
+		, nodes_()
+		, parents_()
+		, categories_()
+		, sortLayers_()
+		, transforms_()
+		, isTraversalValid_(false)
+	{
+	}
+
+	void SceneRoot::update(sf::Time dt, CommandQueue& commands)
+	{
+		if (!flatTraversal_)
+		{
+			SceneNode::update(dt, commands);
+			return;
+		}
+
+		rebuildTraversal();
+
+		std::size_t count = nodes_.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (nodes_[i])
+			{
+				nodes_[i]->rememberState();
+				nodes_[i]->updateCurrent(dt, commands);
+			}
+		}
+
+		// Backwards, so children are queued before their parent like the recursive pass does
+		for (std::size_t i = count; i-- > 0;)
+		{
+			if (nodes_[i])
+			{
+				nodes_[i]->checkRemoval();
+			}
+		}
+	}
+
+	void SceneRoot::onCommand(const Command& command, sf::Time dt)
+	{
+		if (!flatTraversal_)
+		{
+			SceneNode::onCommand(command, dt);
+			return;
+		}
+
+		rebuildTraversal();
+
+		// Only the nodes of the category are touched
+		std::size_t count = nodes_.size();
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			if (nodes_[i] && (command.category & categories_[i]))
+			{
+				command.action(*nodes_[i], dt);
+			}
+		}
+	}
+
+	void SceneRoot::draw(RenderSnapshot& target, sf::RenderStates states) const
+	{
+		bool hasDebugDraw = debugDraw_ && DebugDrawNode::isEnabled();
+
+		target.beginSorting();
+
+		if (!flatTraversal_)
+		{
+			if (hasDebugDraw)
+			{
+				addBoundingBoxes(*this);
+			}
+
+			states.transform *= getInterpolatedTransform();
+			drawCurrent(target, states);
+			for (std::size_t i = 0; i < children_.size(); ++i)
+			{
+				target.setSortLayer(static_cast<std::uint8_t>(std::min<std::size_t>(i + 1, 255)));
+				children_[i]->draw(target, states);
+			}
+
+			target.endSorting();
+			return;
+		}
+
+		rebuildTraversal();
+
+		if (hasDebugDraw)
+		{
+			for (const SceneNode* node : nodes_)
+			{
+				debugDraw_->addRect(node->getBoundingBox(), sf::Color::Cyan);
+			}
+		}
+
+		// A parent comes first, so its world transform is ready for its children
+		transforms_.resize(nodes_.size());
+		for (std::size_t i = 0; i < nodes_.size(); ++i)
+		{
+			const sf::Transform& parentTransform = parents_[i] < 0 ? states.transform : transforms_[parents_[i]];
+			transforms_[i] = parentTransform * nodes_[i]->getInterpolatedTransform();
+
+			sf::RenderStates nodeStates(states);
+			nodeStates.transform = transforms_[i];
+			target.setSortLayer(sortLayers_[i]);
+			target.setSortDepth(static_cast<std::uint8_t>(nodes_[i]->getDrawDepth()));
+			nodes_[i]->drawCurrent(target, nodeStates);
+		}
+
+		target.endSorting();
+	}
+
+	void SceneRoot::checkSceneCollision(PairList& collisionPairs)
+	{
+		if (!flatTraversal_)
+		{
+			SceneNode::checkSceneCollision(*this, collisionPairs);
+			return;
+		}
+
+		rebuildTraversal();
+
+		// Each bounding box is computed once, nodes without one can not collide
+		struct Collider
+		{
+			sf::FloatRect	box;
+			SceneNode*		node;
+		};
+
+		FrameVector<Collider> colliders{ FrameAllocator<Collider>(collisionPairs.get_allocator()) };
+		colliders.reserve(nodes_.size());
+		for (SceneNode* node : nodes_)
+		{
+			sf::FloatRect box = node->getBoundingBox();
+			if ((box.width != 0.f || box.height != 0.f) && !node->isDestroyed())
+			{
+				colliders.push_back({ box, node });
+			}
+		}
+
+		// Every pair once
+		for (std::size_t i = 0; i < colliders.size(); ++i)
+		{
+			for (std::size_t j = i + 1; j < colliders.size(); ++j)
+			{
+				if (colliders[i].box.intersects(colliders[j].box))
+				{
+					collisionPairs.push_back(std::minmax(colliders[i].node, colliders[j].node));
+				}
+			}
+		}
+	}
+
+	void SceneRoot::removeWrecks()
+	{
+		if (wrecks_.empty())
+		{
+			return;
+		}
+
+		// Release every wreck first, a wreck under another wreck is queued before it so its parent is still alive
+		for (SceneNode* wreck : wrecks_)
+		{
+			SceneNode* parent = wreck->parent_;
+			releasedWrecks_.push_back(std::move(parent->children_[wreck->indexInParent_]));
+			wreck->parent_ = nullptr;
+			wreckParents_.push_back(parent);
+		}
+
+		// Then close the gaps once per parent, O(siblings) instead of once per wreck
+		std::sort(wreckParents_.begin(), wreckParents_.end());
+		wreckParents_.erase(std::unique(wreckParents_.begin(), wreckParents_.end()), wreckParents_.end());
+		for (SceneNode* parent : wreckParents_)
+		{
+			parent->compactChildren();
+		}
+
+		// Pooled entities go back to their pools here, see RecycledMemory
+		releasedWrecks_.clear();
+		wreckParents_.clear();
+		wrecks_.clear();
+
+		invalidateTraversal();
+	}
+
+	void SceneRoot::setDebugDraw(const DebugDrawNode* debugDraw)
+	{
+		debugDraw_ = debugDraw;
+	}
+
+	void SceneRoot::setFlatTraversal(bool flat)
+	{
+		flatTraversal_ = flat;
+	}
+
+	bool SceneRoot::isFlatTraversal()
+	{
+		return flatTraversal_;
+	}
+
+	std::size_t SceneRoot::getNodeCount()
+	{
+		return nodeCount_;
+	}
+
+	std::size_t SceneRoot::getRebuildCount()
+	{
+		return rebuildCount_;
+	}
+
+	void SceneRoot::queueRemoval(SceneNode& node)
+	{
+		wrecks_.push_back(&node);
+	}
+
+	void SceneRoot::appendToTraversal(SceneNode& child)
+	{
+		if (!isTraversalValid_)
+		{
+			return; //the next rebuild picks it up
+		}
+
+		const SceneNode& parent = *child.parent_;
+		assert(nodes_[parent.traversalIndex_] == &parent);
+
+		std::uint8_t sortLayer = &parent == this 
+			? static_cast<std::uint8_t>(std::min<std::size_t>(child.indexInParent_ + 1, 255)) 
+			: sortLayers_[parent.traversalIndex_];
+		appendNode(child, static_cast<int>(parent.traversalIndex_), sortLayer);
+
+		nodeCount_ = nodes_.size();
+	}
+
+	void SceneRoot::removeFromTraversal(const SceneNode& child)
+	{
+		// The arrays are rebuilt before the next pass, the one running may still walk them
+		forgetNode(child);
+		invalidateTraversal();
+	}
+
+	void SceneRoot::forgetNode(const SceneNode& node)
+	{
+		if (node.traversalIndex_ < nodes_.size() && nodes_[node.traversalIndex_] == &node)
+		{
+			nodes_[node.traversalIndex_] = nullptr;
+		}
+		if (node.isQueuedForRemoval_)
+		{
+			wrecks_.erase(std::remove(wrecks_.begin(), wrecks_.end(), &node), wrecks_.end());
+		}
+
+		for (const Ptr& child : node.children_)
+		{
+			forgetNode(*child);
+		}
+	}
+
+	void SceneRoot::invalidateTraversal()
+	{
+		isTraversalValid_ = false;
+	}
+
+	void SceneRoot::addBoundingBoxes(const SceneNode& node) const
+	{
+		debugDraw_->addRect(node.getBoundingBox(), sf::Color::Cyan);
+		for (const Ptr& child : node.children_)
+		{
+			addBoundingBoxes(*child);
+		}
+	}
+
+	void SceneRoot::rebuildTraversal() const
+	{
+		if (isTraversalValid_)
+		{
+			return;
+		}
+
+		// The arrays keep their capacity, rebuilding does not allocate once the scene stops growing
+		nodes_.clear();
+		parents_.clear();
+		categories_.clear();
+		sortLayers_.clear();
+
+		nodes_.push_back(const_cast<SceneRoot*>(this)); //index 0, its traversalIndex_ never changes
+		parents_.push_back(-1);
+		categories_.push_back(getCategory());
+		sortLayers_.push_back(0);
+
+		for (std::size_t i = 0; i < children_.size(); ++i)
+		{
+			appendNode(*children_[i], 0, static_cast<std::uint8_t>(std::min<std::size_t>(i + 1, 255)));
+		}
+
+		isTraversalValid_ = true;
+		nodeCount_ = nodes_.size();
+		++rebuildCount_;
+	}
+
+	void SceneRoot::appendNode(SceneNode& node, int parent, std::uint8_t sortLayer) const
+	{
+		int index = static_cast<int>(nodes_.size());
+		node.traversalIndex_ = nodes_.size();
+		nodes_.push_back(&node);
+		parents_.push_back(parent);
+		categories_.push_back(node.getCategory());
+		sortLayers_.push_back(sortLayer);
+
+		for (const Ptr& child : node.children_)
+		{
+			appendNode(*child, index, sortLayer);
+		}
+	}
+}
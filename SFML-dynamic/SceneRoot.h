@@ -0,0 +1,99 @@
+/**
+* @file
+* SceneRoot.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include "SceneNode.h"
+#include "DebugDrawNode.h"
+
+namespace GEX
+{
+	// Root of the scene graph, keeps the nodes marked for removal during the tick
+	// so only they are visited when the wrecks are removed, the siblings left keep their order
+	//
+	// The update, command, draw and collision passes walk a flat copy of the tree:
+	// the nodes in depth-first order with their parent index and category in contiguous arrays
+	// An attached subtree is appended to the arrays, they are rebuilt in tree order only after a detach
+	// A subtree detached during a pass leaves empty entries, the pass skips them
+	//
+	// Each child of the root is a sort layer, the draws of a layer are ordered by state in the snapshot
+	class SceneRoot : public SceneNode
+	{
+	public:
+								SceneRoot();
+
+		// Same passes as SceneNode, without recursion
+		void					update(sf::Time dt, CommandQueue& commands) override;
+		void					onCommand(const Command& command, sf::Time dt) override;
+		void					draw(RenderSnapshot& target, sf::RenderStates states) const override;
+		void					checkSceneCollision(PairList& collisionPairs);
+
+		void					removeWrecks();	//end of the tick
+
+		// Bounding boxes are added to it while debug drawing is enabled
+		void					setDebugDraw(const DebugDrawNode* debugDraw);
+
+		// false walks the pointer tree like any other SceneNode, to compare both
+		static void				setFlatTraversal(bool flat);
+		static bool				isFlatTraversal();
+
+		// For the stats overlay
+		static std::size_t		getNodeCount();
+		static std::size_t		getRebuildCount();
+
+	private:
+		void					queueRemoval(SceneNode& node) override;
+		void					appendToTraversal(SceneNode& child) override;
+		void					removeFromTraversal(const SceneNode& child) override;
+		void					forgetNode(const SceneNode& node);	//recursive, for a subtree detached during a pass
+		void					invalidateTraversal();
+
+		void					addBoundingBoxes(const SceneNode& node) const;	//recursive, for the tree traversal
+
+		void					rebuildTraversal() const;
+		void					appendNode(SceneNode& node, int parent, std::uint8_t sortLayer) const;
+
+	private:
+		std::vector<SceneNode*>				wrecks_;
+		std::vector<Ptr>					releasedWrecks_;	//destroyed once every parent is compacted
+		std::vector<SceneNode*>				wreckParents_;
+		const DebugDrawNode*				debugDraw_;
+
+		// Nodes attached during a pass are picked up by the next one
+		mutable std::vector<SceneNode*>		nodes_;			//a node comes before its children, appended subtrees come last
+		mutable std::vector<int>			parents_;		//index in nodes_, -1 for the root
+		mutable std::vector<unsigned int>	categories_;	//fixed for the lifetime of a node
+		mutable std::vector<std::uint8_t>	sortLayers_;	//1 + index of the root child the node is under
+		mutable std::vector<sf::Transform>	transforms_;	//world transforms of the last draw
+		mutable bool						isTraversalValid_;
+
+		static bool							flatTraversal_;
+		static std::size_t					nodeCount_;
+		static std::size_t					rebuildCount_;
+	};
+}
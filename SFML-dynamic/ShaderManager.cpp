@@ -0,0 +1,93 @@
+/**
+* @file
+* ShaderManager.cpp
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#include "ShaderManager.h"
+#include <cassert>
+#include <stdexcept>
+#include <string>
+
+namespace GEX
+{
+	namespace
+	{
+		struct ShaderFiles
+		{
+			const char*	vertex;
+			const char*	fragment;
+		};
+
+		// by ShaderID
+		const ShaderFiles FILES[] =
+		{
+			{ "Media/Shaders/Fullpass.vert", "Media/Shaders/Brightness.frag" },
+			{ "Media/Shaders/Fullpass.vert", "Media/Shaders/DownSample.frag" },
+			{ "Media/Shaders/Fullpass.vert", "Media/Shaders/GuassianBlur.frag" },
+			{ "Media/Shaders/Fullpass.vert", "Media/Shaders/Add.frag" },
+		};
+
+		static_assert(sizeof(FILES) / sizeof(FILES[0]) == static_cast<std::size_t>(ShaderID::Count), "One entry per ShaderID");
+	}
+
+	ShaderManager* ShaderManager::instance_ = nullptr;
+
+	ShaderManager& ShaderManager::getInstance()
+	{
+		if (!instance_)
+		{
+			ShaderManager::instance_ = new ShaderManager();
+		}
+
+		return *ShaderManager::instance_;
+	}
+
+	sf::Shader& ShaderManager::get(ShaderID id)
+	{
+		std::size_t index = static_cast<std::size_t>(id);
+		assert(index < shaders_.size());
+
+		if (!shaders_[index])
+		{
+			std::unique_ptr<sf::Shader> shader(new sf::Shader());
+			if (!shader->loadFromFile(FILES[index].vertex, FILES[index].fragment))
+			{
+				throw std::runtime_error(std::string("Shader load failed: ") + FILES[index].fragment);
+			}
+
+			shaders_[index] = std::move(shader);
+			++compileCount_;
+		}
+
+		return *shaders_[index];
+	}
+
+	std::size_t ShaderManager::getCompileCount() const
+	{
+		return compileCount_;
+	}
+}
@@ -0,0 +1,56 @@
+/**
+* @file
+* ShaderManager.h
+* @author
+* Marco Corsini Baccaro 2018
+* @version 1.0
+*
+* @section DESCRIPTION
+* Assignment #1 - The GexState (Oct, 8th)
+*
+* @section LICENSE
+*
+* Copyright 2018
+* Permission to use, copy, modify, and/or distribute this software for
+* any purpose with or without fee is hereby granted, provided that the
+* above copyright notice and this permission notice appear in all copies.
+*
+* THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+* WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+* MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+* ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+* WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+* ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+* OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*
+* @section Academic Integrity
+* I certify that this work is solely my own and complies with
+* NBCC Academic Integrity Policy (policy 1111)
+*/
+#pragma once
+#include <array>
+#include <memory>
+#include "ResourceIdentifier.h"
+#include <SFML/Graphics/Shader.hpp>
+
+namespace GEX
+{
+	// Compiled shader programs shared by the whole process
+	// A program is compiled the first time it is requested and kept until exit
+	class ShaderManager
+	{
+	private:
+		ShaderManager() = default;
+
+	public:
+		static ShaderManager&								getInstance();
+
+		sf::Shader&											get(ShaderID id);
+		std::size_t											getCompileCount() const;
+
+	private:
+		static ShaderManager*								instance_;
+		std::array<std::unique_ptr<sf::Shader>, static_cast<std::size_t>(ShaderID::Count)>	shaders_;
+		std::size_t											compileCount_ = 0;
+	};
+}
@@ -28,7 +28,16 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 #include "SoundNode.h"
+#include "Utility.h"
+#include <algorithm>
 
+namespace
+{
+	// Events of the same effect closer than this radius are played as a single voice
+	const float CoalesceRadius = 150.f;
+	// Each merged event adds a bit of gain to the voice, up to SoundPlayer::MaxGain
+	const float GainPerEvent = 0.25f;
+}
 
 namespace GEX
 {
@@ -36,16 +45,40 @@ namespace GEX
 	SoundNode::SoundNode(SoundPlayer& player)
 		: SceneNode()
 		, sounds_(player)
+		, pendingSounds_()
 	{
 	}
 
 	void SoundNode::playSound(SoundEffectID sound, sf::Vector2f position)
 	{
-		sounds_.play(sound, position);
+		for (auto& e : pendingSounds_)
+		{
+			if (e.effect == sound && length(e.position - position) < CoalesceRadius)
+			{
+				// Keep the voice at the center of the merged events
+				e.position = (e.position * static_cast<float>(e.count) + position) / static_cast<float>(e.count + 1);
+				e.gain = std::min(e.gain + GainPerEvent, SoundPlayer::MaxGain);
+				e.count++;
+				return;
+			}
+		}
+
+		pendingSounds_.push_back(SoundEvent{ sound, position, 1.f, 1 });
 	}
 
 	unsigned int SoundNode::getCategory() const
 	{
 		return Category::SoundEffect;
 	}
+
+	void SoundNode::updateCurrent(sf::Time dt, CommandQueue & commands)
+	{
+		// All sound commands of the frame were already executed, flush the merged voices
+		for (const auto& e : pendingSounds_)
+		{
+			sounds_.play(e.effect, e.position, e.gain);
+		}
+
+		pendingSounds_.clear();
+	}
 }
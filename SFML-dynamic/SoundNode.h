@@ -31,6 +31,7 @@
 #include "SceneNode.h"
 #include "ResourceIdentifier.h"
 #include "SoundPlayer.h"
+#include <vector>
 
 namespace GEX
 {
@@ -45,7 +46,21 @@ namespace GEX
 		unsigned int	getCategory() const override;
 
 	private:
-		SoundPlayer&	sounds_;
+		void			updateCurrent(sf::Time dt, CommandQueue& commands) override;
+
+	private:
+		// Same effect events requested on the same frame and close to each other are merged into one voice
+		struct SoundEvent
+		{
+			SoundEffectID		effect;
+			sf::Vector2f		position;
+			float				gain;
+			int					count;
+		};
+
+	private:
+		SoundPlayer&			sounds_;
+		std::vector<SoundEvent>	pendingSounds_;
 	};
 }
 
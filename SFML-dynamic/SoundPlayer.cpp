@@ -28,8 +28,9 @@
 * NBCC Academic Integrity Policy (policy 1111)
 */
 #include "SoundPlayer.h"
-#include <SFML/Audio/Listener.hpp>
-#include <cassert>
+#include "OpenALAudioBackend.h"
+#include <algorithm>
+#include <cmath>
 
 namespace
 {
@@ -43,22 +44,18 @@ namespace
 
 namespace GEX
 {
+	const float SoundPlayer::MaxGain = 2.f;
 
 	SoundPlayer::SoundPlayer()
-		: soundBuffers_()
-		, sounds_()
-		, volume_(100)
+		: SoundPlayer(std::unique_ptr<AudioBackend>(new OpenALAudioBackend()))
 	{
-		loadBuffer(SoundEffectID::AlliedGunfire, "Media/Sound/AlliedGunfire.wav");
-		loadBuffer(SoundEffectID::EnemyGunfire, "Media/Sound/EnemyGunfire.wav");
-		loadBuffer(SoundEffectID::Explosion1, "Media/Sound/Explosion1.wav");
-		loadBuffer(SoundEffectID::Explosion2, "Media/Sound/Explosion2.wav");
-		loadBuffer(SoundEffectID::LaunchMissile, "Media/Sound/LaunchMissile.wav");
-		loadBuffer(SoundEffectID::CollectPickup, "Media/Sound/CollectPickup.wav");
-		loadBuffer(SoundEffectID::Button, "Media/Sound/Button.wav");
+	}
 
-		// Listener points towards the screen (default in SFML)
-		sf::Listener::setDirection(0.f, 0.f, -1.f);
+	SoundPlayer::SoundPlayer(std::unique_ptr<AudioBackend> backend)
+		: backend_(std::move(backend))
+		, volume_(100)
+	{
+		loadBuffers();
 	}
 
 	void SoundPlayer::play(SoundEffectID effect)
@@ -68,44 +65,58 @@ namespace GEX
 
 	void SoundPlayer::play(SoundEffectID effect, sf::Vector2f position)
 	{
-		sounds_.push_back(sf::Sound());
-		sf::Sound& sound = sounds_.back();
-
-		sound.setBuffer(*soundBuffers_.at(effect));
-		sound.setPosition(position.x, -position.y, 0);
-		sound.setAttenuation(Attenuation);
-		sound.setMinDistance(MinDistance3D);
+		play(effect, position, 1.f);
+	}
 
-		sound.setVolume(volume_);
-		sound.play();
+	void SoundPlayer::play(SoundEffectID effect, sf::Vector2f position, float gain)
+	{
+		// A voice can not play above 100, what is left of a merged gain goes to another voice
+		// of the same effect, started together at the same place they add up
+		float volume = volume_ * std::min(gain, MaxGain);
+		while (volume > 0.f)
+		{
+			float voice = std::min(volume, 100.f);
+			backend_->play(
+				effect,
+				sf::Vector3f(position.x, -position.y, 0.f),
+				Attenuation,
+				MinDistance3D,
+				voice
+			);
+			volume -= voice;
+		}
 	}
 
 	void SoundPlayer::removeStoppedSounds()
 	{
-		sounds_.remove_if([](const sf::Sound& s) {return s.getStatus() == sf::Sound::Stopped; });
+		backend_->removeStoppedSounds();
 	}
 
 	void SoundPlayer::setListenerPosition(sf::Vector2f position)
 	{
-		sf::Listener::setPosition(position.x, -position.y, ListenerZ);
+		backend_->setListenerPosition(sf::Vector3f(position.x, -position.y, ListenerZ));
 	}
 
 	sf::Vector2f SoundPlayer::getListenerPosition() const
 	{
-		auto position = sf::Listener::getPosition();
+		auto position = backend_->getListenerPosition();
 		return sf::Vector2f(position.x, -position.y);
 	}
 
-	void SoundPlayer::loadBuffer(SoundEffectID id, const std::string path)
+	AudioBackend & SoundPlayer::getBackend()
 	{
-		std::unique_ptr<sf::SoundBuffer> buffer(new sf::SoundBuffer);
-		if (!buffer->loadFromFile(path))
-		{
-			throw std::runtime_error("Sound effect load failed");
-		}
+		return *backend_;
+	}
 
-		auto inserted = soundBuffers_.insert(std::make_pair(id, std::move(buffer)));
-		assert(inserted.second);
+	void SoundPlayer::loadBuffers()
+	{
+		backend_->loadBuffer(SoundEffectID::AlliedGunfire, "Media/Sound/AlliedGunfire.wav");
+		backend_->loadBuffer(SoundEffectID::EnemyGunfire, "Media/Sound/EnemyGunfire.wav");
+		backend_->loadBuffer(SoundEffectID::Explosion1, "Media/Sound/Explosion1.wav");
+		backend_->loadBuffer(SoundEffectID::Explosion2, "Media/Sound/Explosion2.wav");
+		backend_->loadBuffer(SoundEffectID::LaunchMissile, "Media/Sound/LaunchMissile.wav");
+		backend_->loadBuffer(SoundEffectID::CollectPickup, "Media/Sound/CollectPickup.wav");
+		backend_->loadBuffer(SoundEffectID::Button, "Media/Sound/Button.wav");
 	}
 
 }
\ No newline at end of file
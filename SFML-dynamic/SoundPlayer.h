@@ -29,14 +29,11 @@
 */
 #pragma once
 
-#include <SFML/Audio/SoundBuffer.hpp>
-#include <SFML/Audio/Sound.hpp>
 #include "ResourceIdentifier.h"
+#include "AudioBackend.h"
 #include <SFML/System/Vector2.hpp>
 
-#include <map>
 #include <memory>
-#include <list>
 #include <string>
 
 namespace GEX
@@ -44,22 +41,28 @@ namespace GEX
 	class SoundPlayer
 	{
 	public:
+		// Gain of merged events, a gain of 1 plays at the volume and more than that plays louder
+		static const float											MaxGain;
+
 																	SoundPlayer();
+		explicit													SoundPlayer(std::unique_ptr<AudioBackend> backend);
 																	~SoundPlayer() = default;
 																	SoundPlayer(const SoundPlayer&) = delete;
 		SoundPlayer&												operator=(const SoundPlayer&) = delete;
 		void														play(SoundEffectID effect);
 		void														play(SoundEffectID effect, sf::Vector2f position);
+		void														play(SoundEffectID effect, sf::Vector2f position, float gain);
 		void														removeStoppedSounds();
 		void														setListenerPosition(sf::Vector2f position);
 		sf::Vector2f												getListenerPosition() const;
 
+		AudioBackend&												getBackend();
+
 	private:
-		void														loadBuffer(SoundEffectID id, const std::string path);
+		void														loadBuffers();
 
 	private:
-		std::map<SoundEffectID, std::unique_ptr<sf::SoundBuffer>>	soundBuffers_;
-		std::list<sf::Sound>										sounds_;
+		std::unique_ptr<AudioBackend>								backend_;
 		float														volume_;
 	};
 }
@@ -30,12 +30,155 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include "Aplication.h"
+#include "SceneRoot.h"
+#include "ParticleNode.h"
+#include <string>
+#include <iostream>
+#include <cctype>
+#include <cstdlib>
+#include <memory>
 
-int main()
+namespace
 {
-	Aplication game;
+	void printUsage(const char* program)
+	{
+		std::cerr << "usage: " << program 
+			<< " [--record <file> | --replay <file>] [--alloc-budget <n>] [--scene flat|tree] [--particles buffer|array] [--audio openal|null|offline]" << std::endl;
+	}
+
+	bool isCount(const std::string& text)
+	{
+		if (text.empty() || text.size() > 9)
+		{
+			return false;
+		}
+		for (char c : text)
+		{
+			if (!std::isdigit(static_cast<unsigned char>(c)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+// --record <file> or --replay <file> records or replays the input of the games played, not both
+// --alloc-budget <n> sets the allocations allowed per frame, see AllocationTracker, exits with 1 when exceeded
+// --scene tree walks the scene graph recursively instead of flat, see SceneRoot
+// --particles array draws particles from vertex arrays instead of a vertex buffer, see ParticleNode
+// --audio null or offline plays without an audio device, the GEX_AUDIO environment variable does the same
+// bad arguments print the usage and exit with 2
+int main(int argc, char* argv[])
+{
+	std::string recordPath;
+	std::string replayPath;
+	std::string audio = std::getenv("GEX_AUDIO") ? std::getenv("GEX_AUDIO") : "openal";
+	unsigned int allocationBudget = 0;
+	bool hasAllocationBudget = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string option = argv[i];
+		if (i + 1 >= argc)
+		{
+			std::cerr << option << " needs a value" << std::endl;
+			printUsage(argv[0]);
+			return 2;
+		}
+
+		std::string value = argv[++i];
+		if (option == "--record")
+		{
+			recordPath = value;
+		}
+		else if (option == "--replay")
+		{
+			replayPath = value;
+		}
+		else if (option == "--alloc-budget")
+		{
+			if (!isCount(value))
+			{
+				std::cerr << "--alloc-budget expects a count, got " << value << std::endl;
+				printUsage(argv[0]);
+				return 2;
+			}
+			allocationBudget = static_cast<unsigned int>(std::stoul(value));
+			hasAllocationBudget = true;
+		}
+		else if (option == "--scene")
+		{
+			if (value != "flat" && value != "tree")
+			{
+				std::cerr << "--scene expects flat or tree, got " << value << std::endl;
+				printUsage(argv[0]);
+				return 2;
+			}
+			GEX::SceneRoot::setFlatTraversal(value == "flat");
+		}
+		else if (option == "--particles")
+		{
+			if (value != "buffer" && value != "array")
+			{
+				std::cerr << "--particles expects buffer or array, got " << value << std::endl;
+				printUsage(argv[0]);
+				return 2;
+			}
+			GEX::ParticleNode::setVertexBuffers(value == "buffer");
+		}
+		else if (option == "--audio")
+		{
+			audio = value;
+		}
+		else
+		{
+			std::cerr << "unknown option " << option << std::endl;
+			printUsage(argv[0]);
+			return 2;
+		}
+	}
+
+	if (!recordPath.empty() && !replayPath.empty())
+	{
+		std::cerr << "--record and --replay can not be used together" << std::endl;
+		printUsage(argv[0]);
+		return 2;
+	}
+
+	// The backend is picked before the game opens the audio device
+	std::unique_ptr<GEX::AudioBackend> backend = GEX::createAudioBackend(audio);
+	if (!backend)
+	{
+		std::cerr << "unknown audio backend " << audio << std::endl;
+		printUsage(argv[0]);
+		return 2;
+	}
+
+	Aplication game(std::move(backend));
+
+	if (!recordPath.empty())
+	{
+		game.recordInput(recordPath);
+	}
+	if (!replayPath.empty() && !game.replayInput(replayPath))
+	{
+		return 2;
+	}
+	if (hasAllocationBudget)
+	{
+		game.setAllocationBudget(allocationBudget);
+	}
+
 	game.run();
 
+	// a replay run over the allocation budget fails
+	if (game.hasExceededAllocationBudget())
+	{
+		std::cerr << game.getAllocationBudgetReport() << std::endl;
+		return 1;
+	}
+
 	/*
 	sf::RenderWindow window(sf::VideoMode(600, 400), "SFML works!");
 	sf::CircleShape shape(10.f);
@@ -49,7 +49,7 @@ namespace GEX
 		sprite_.setTextureRect(textureRect);
 	}
 
-	void SpriteNode::drawCurrent(sf::RenderTarget & target, sf::RenderStates states) const
+	void SpriteNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
 		target.draw(sprite_, states);
 	}
@@ -47,7 +47,7 @@ namespace GEX
 		void		setSprite(const sf::Texture& texture, const sf::IntRect& textureRect);
 
 	private:
-		virtual void drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		virtual void drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
 	private:
 		sf::Sprite sprite_;
@@ -35,6 +35,7 @@
 #include "StatesIdentifiers.h"
 #include <memory>
 #include "MusicPlayer.h"
+#include "RenderSnapshot.h"
 //#include "StateStack.h"
 
 namespace GEX
@@ -69,7 +70,7 @@ namespace GEX
 								State(StateStack& stack, Context context);
 		virtual					~State();
 
-		virtual void			draw() = 0;
+		virtual void			draw(RenderSnapshot& target) = 0;
 		virtual bool			update(sf::Time) = 0;
 		virtual bool			handleEvent(const sf::Event& event) = 0;
 
@@ -57,11 +57,11 @@ namespace GEX
 		}
 	}
 
-	void StateStack::draw()
+	void StateStack::draw(RenderSnapshot& target)
 	{
 		for (auto& itr : stack_)
 		{
-			itr->draw();
+			itr->draw(target);
 		}
 	}
 
@@ -74,8 +74,6 @@ namespace GEX
 				break;
 			}
 		}
-
-		applyPendingChanges();
 	}
 
 	void StateStack::pushState(GEX::StateID stateID)
@@ -98,6 +96,11 @@ namespace GEX
 		return stack_.empty();
 	}
 
+	bool StateStack::hasPendingChanges() const
+	{
+		return !pendingList_.empty();
+	}
+
 	State::Ptr StateStack::createState(GEX::StateID stateID)
 	{
 		auto found = factories_.find(stateID);
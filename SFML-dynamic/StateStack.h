@@ -63,9 +63,13 @@ namespace GEX
 		void		registerState(GEX::StateID stateID);
 
 		void		update(sf::Time dt);
-		void		draw();
+		void		draw(RenderSnapshot& target);
 		void		handleEvent(const sf::Event& event);
 
+		// Stack changes are applied by the owner, which first makes sure nothing is drawing the old states
+		bool		hasPendingChanges() const;
+		void		applyPendingChanges();
+
 		void		pushState(StateID stateID);
 		void		popState();
 		void		clearStates();
@@ -74,7 +78,6 @@ namespace GEX
 
 	private:
 		State::Ptr	createState(StateID stateID);
-		void		applyPendingChanges();
 
 	private:
 		struct PendingChange
@@ -44,12 +44,18 @@ namespace GEX
 
 	void TextNode::setText(const std::string & text, const sf::Color color)
 	{
+		// Avoid rebuilding the glyphs when nothing changed
+		if (text_.getString() == text && text_.getFillColor() == color)
+		{
+			return;
+		}
+
 		text_.setString(text);
 		text_.setFillColor(color);
 		centerOrigin(text_);
 	}
 
-	void TextNode::drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const
+	void TextNode::drawCurrent(RenderSnapshot& target, sf::RenderStates states) const
 	{
 		target.draw(text_, states);
 	}
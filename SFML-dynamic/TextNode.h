@@ -43,7 +43,7 @@ namespace GEX
 
 
 	private:
-		void			drawCurrent(sf::RenderTarget& target, sf::RenderStates states) const override;
+		void			drawCurrent(RenderSnapshot& target, sf::RenderStates states) const override;
 
 	private:
 		sf::Text		text_;
@@ -49,14 +49,14 @@ TitleState::TitleState(GEX::StateStack& stack, Context context)
 	text_.setPosition(context.window_->getView().getSize() / 2.f);
 }
 
-void TitleState::draw()
+void TitleState::draw(GEX::RenderSnapshot& target)
 {
 	auto& window = *getContext().window_;
 
-	window.draw(backgroundSprite_);
+	target.draw(backgroundSprite_);
 
 	if (showText_) {
-		window.draw(text_);
+		target.draw(text_);
 	}
 }
 
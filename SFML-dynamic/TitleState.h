@@ -36,7 +36,7 @@ class TitleState : public GEX::State
 public:
 	TitleState(GEX::StateStack& stack, Context context);
 
-	void					draw() override;
+	void					draw(GEX::RenderSnapshot& target) override;
 	bool					update(sf::Time dt) override;
 	bool					handleEvent(const sf::Event& event) override;
 
@@ -49,8 +49,7 @@ namespace
 {
 	std::default_random_engine createRandomEngine()
 	{
-		auto seed = static_cast<unsigned long>(std::time(nullptr));
-		return std::default_random_engine(seed);
+		return std::default_random_engine(createRandomSeed());
 	}
 
 	auto RandomEngine = createRandomEngine();
@@ -90,6 +89,16 @@ int randomInt(int exclusiveMax)
 	return distr(RandomEngine);
 }
 
+unsigned int createRandomSeed()
+{
+	return static_cast<unsigned int>(std::time(nullptr));
+}
+
+void seedRandomEngine(unsigned int seed)
+{
+	RandomEngine.seed(seed);
+}
+
 float length(sf::Vector2f vector)
 {
 	return std::sqrt(vector.x * vector.x + vector.y * vector.y);
@@ -47,6 +47,8 @@ float			toRadian(float degree);
 
 // Random number generation
 int				randomInt(int exclusiveMax);
+unsigned int	createRandomSeed();
+void			seedRandomEngine(unsigned int seed); //same seed, same numbers
 
 // Vector operations
 float			length(sf::Vector2f vector);
@@ -34,15 +34,21 @@
 #include "ParticleNode.h"
 #include <SFML/Graphics/RenderTarget.hpp>
 #include "SoundNode.h"
+#include "FontManager.h"
+#include "AllocationTracker.h"
 
 namespace GEX
 {
+	sf::Time World::levelLoadTime_ = sf::Time::Zero;
+	std::size_t World::levelSpawnPoints_ = 0;
 
 	World::World(sf::RenderTarget& outputTarget, SoundPlayer& sounds)
-		: target_(outputTarget)
-		, sounds_(sounds)
+		: sounds_(sounds)
 		, worldView_(outputTarget.getDefaultView())
+		, previousViewCenter_()
+		, lastTick_(SceneNode::getTick())
 		, textures_()
+		, particleSystems_()
 		, sceneGraph_()
 		, sceneLayers_()
 		, worldBounds_(0.f, 0.f, worldView_.getSize().x, 5000.f)
@@ -50,22 +56,49 @@ namespace GEX
 		, scrollSpeed_(-150.f)
 		, counter_(1)
 		, orientation_(1)
+		, explosions_(nullptr)
 		, commandQueue_()
+		, enemySpawnPoints_()
+		, nextSpawnPoint_(0)
+		, nextPrewarmPoint_(0)
+		, prewarmedEnemies_()
+		, frameArena_(64 * 1024)
+		, activeEnemies_(FrameAllocator<Aircraft*>(frameArena_))
 	{
 
-		sceneTexture_.create(target_.getSize().x, target_.getSize().y);
-
 		loadTextures();
 
+		// Spawn points and stats of the mission
+		sf::Clock loadClock;
+		LevelData level = loadLevel("Media/Levels/Mission1.txt", "Media/Levels/Mission1.bin");
+		applyLevelStats(level);
+		levelLoadTime_ = loadClock.getElapsedTime();
+		levelSpawnPoints_ = level.spawns.size();
+
 		//prepare the view
 
 		worldView_.setCenter(spawnPosition_);
+		previousViewCenter_ = spawnPosition_;
 
 		buildScene();
+		addEnemies(level.spawns);
+	}
+
+	sf::Time World::getLevelLoadTime()
+	{
+		return levelLoadTime_;
+	}
+
+	std::size_t World::getLevelSpawnPoints()
+	{
+		return levelSpawnPoints_;
 	}
 
 	void World::update(sf::Time dt, CommandQueue& commands)
 	{
+		resetFrameData();
+		lastTick_ = SceneNode::getTick();
+
 		// For fun!! Replacing the background when it world bounds ends
 		/*if (worldView_.getCenter().y - (worldView_.getSize().y / 2 - 50) < 50)
 		{
@@ -78,6 +111,7 @@ namespace GEX
 			background_->setSprite(texture, textureRect);
 		}*/
 		// scroll the world
+		previousViewCenter_ = worldView_.getCenter();
 		worldView_.move(0.f, scrollSpeed_*dt.asSeconds());
 
 		//Remove previous velocity
@@ -89,6 +123,9 @@ namespace GEX
 		//Process guided missile
 		guideMissiles();
 
+		// particle level of detail for this tick
+		particleSystems_.update(getViewBounds());
+
 		// run all commands in the command queue
 		while (!commandQueue_.isEmpty())
 		{
@@ -98,17 +135,20 @@ namespace GEX
 		//Handleling collisions
 		handleCollision();
 
-		//remove all wrecks from the scene graph
-		sceneGraph_.removeWrecks();
-
 		adaptPlayerVelocity();
-		sceneGraph_.update(dt, commands);
+		{
+			AllocationScope scope(AllocationZone::SceneUpdate);
+			sceneGraph_.update(dt, commands);
+		}
 		adaptPlayerPosition();
 
 		//check if there are any enemy inside of the battlefield and spawn it
 		spawnEmenies();
 		updateSound();
 
+		//remove the nodes marked for removal during the tick
+		sceneGraph_.removeWrecks();
+
 	}
 
 	void World::adaptPlayerPosition()
@@ -136,30 +176,19 @@ namespace GEX
 		player_->accelerate(0.f, scrollSpeed_);
 	}
 
-	void World::addEnemies()
+	void World::addEnemies(const std::vector<SpawnData>& spawns)
 	{
-		addEnemy(AircraftType::Raptor, -250.f, 600.f);
-		addEnemy(AircraftType::Raptor, 0.f, 600.f);
-		addEnemy(AircraftType::Raptor, +250.f, 600.f);
-
-		addEnemy(AircraftType::Raptor, -250.f, 900.f);
-		addEnemy(AircraftType::Raptor, 0.f, 900.f);
-		addEnemy(AircraftType::Raptor, +250.f, 900.f);
-
-		addEnemy(AircraftType::Avenger, -70.f, 800.f);
-		addEnemy(AircraftType::Avenger, 70.f, 800.f);
-
-		addEnemy(AircraftType::Avenger, -70.f, 1200.f);
-		addEnemy(AircraftType::Avenger, 70.f, 1200.f);
-
-		addEnemy(AircraftType::Avenger, -170.f, 1800.f);
-		addEnemy(AircraftType::Avenger, 170.f, 1800.f);
+		enemySpawnPoints_.reserve(spawns.size());
+		for (const SpawnData& spawn : spawns)
+		{
+			addEnemy(spawn.type, spawn.x, spawn.y);
+		}
 		
-		//Sort the enemy vector by Y position
+		//Sort the enemy vector by Y position, the view scrolls up so the bottom ones spawn first
 		std::sort(enemySpawnPoints_.begin(), enemySpawnPoints_.end(),
 			[] (SpawnPoint lhs, SpawnPoint rhs)
 			{
-				return lhs.y < rhs.y;
+				return lhs.y > rhs.y;
 			}
 			);
 
@@ -172,20 +201,64 @@ namespace GEX
 
 	void World::spawnEmenies()
 	{
-		//Check if the vector is not empty and the last element is inside of the battlegrounds
-		while (!enemySpawnPoints_.empty() && enemySpawnPoints_.back().y > getBattlefieldBounds().top) {
-
-			auto spawnPoint = enemySpawnPoints_.back();
-			std::unique_ptr<Aircraft> enemy(new Aircraft(spawnPoint.type, textures_));
-			enemy->setPosition(spawnPoint.x, spawnPoint.y);
-			enemy->setVelocity(0.f, -scrollSpeed_);
-			enemy->rotate(180);
+		AllocationScope scope(AllocationZone::Spawn);
+
+		const float battlefieldTop = getBattlefieldBounds().top;
+
+		//Spawn every point that is inside of the battlegrounds
+		while (nextSpawnPoint_ < enemySpawnPoints_.size() && enemySpawnPoints_[nextSpawnPoint_].y > battlefieldTop)
+		{
+			std::unique_ptr<Aircraft> enemy;
+			if (!prewarmedEnemies_.empty())
+			{
+				enemy = std::move(prewarmedEnemies_.front());
+				prewarmedEnemies_.pop_front();
+			}
+			else
+			{
+				//Not built ahead of time, build it now
+				const SpawnPoint& spawnPoint = enemySpawnPoints_[nextSpawnPoint_];
+				enemy = createEnemy(spawnPoint.type, sf::Vector2f(spawnPoint.x, spawnPoint.y));
+				nextPrewarmPoint_++;
+			}
+
 			sceneLayers_[UpperAir]->attachChild(std::move(enemy));
-			enemySpawnPoints_.pop_back();
+			nextSpawnPoint_++;
+		}
+
+		prewarmEnemies(battlefieldTop);
+	}
+
+	void World::prewarmEnemies(float battlefieldTop)
+	{
+		//Build the enemies that will spawn soon, a few per frame, so a big formation does not land on one frame
+		const float lookahead = std::abs(scrollSpeed_) * PREWARM_TIME.asSeconds();
+
+		for (std::size_t built = 0; built < PREWARM_BUDGET; ++built)
+		{
+			if (nextPrewarmPoint_ >= enemySpawnPoints_.size() || enemySpawnPoints_[nextPrewarmPoint_].y <= battlefieldTop - lookahead)
+			{
+				break;
+			}
 
+			const SpawnPoint& spawnPoint = enemySpawnPoints_[nextPrewarmPoint_];
+			prewarmedEnemies_.push_back(createEnemy(spawnPoint.type, sf::Vector2f(spawnPoint.x, spawnPoint.y)));
+			nextPrewarmPoint_++;
 		}
 	}
 
+	std::unique_ptr<Aircraft> World::createEnemy(AircraftType type, sf::Vector2f position)
+	{
+		std::unique_ptr<Aircraft> enemy(new Aircraft(type, textures_));
+		enemy->setPosition(position);
+		enemy->setVelocity(0.f, -scrollSpeed_);
+		enemy->rotate(180);
+		enemy->setLabelBatch(labels_);
+		enemy->setParticleRegistry(&particleSystems_);
+		enemy->setExplosionSystem(explosions_);
+		return enemy;
+	}
+
 	sf::FloatRect World::getViewBounds() const
 	{
 		return sf::FloatRect(worldView_.getCenter() - worldView_.getSize() / 2.f, worldView_.getSize());
@@ -199,6 +272,14 @@ namespace GEX
 		return bounds;
 	}
 
+	void World::resetFrameData()
+	{
+		// Nothing built from the arena last tick may be used after the reset
+		FrameVector<Aircraft*>(FrameAllocator<Aircraft*>(frameArena_)).swap(activeEnemies_);
+
+		frameArena_.reset();
+	}
+
 	void World::guideMissiles()
 	{
 		// Build a list of active Enemies
@@ -268,10 +349,16 @@ namespace GEX
 
 	void World::handleCollision()
 	{
+		AllocationScope scope(AllocationZone::Collision);
+
 		// Build a list of collinding Pairs of SceneNode
-		std::set<SceneNode::Pair> collisionPairs;
+		SceneNode::PairList collisionPairs{ FrameAllocator<SceneNode::Pair>(frameArena_) };
 
-		sceneGraph_.checkSceneCollision(sceneGraph_, collisionPairs);
+		sceneGraph_.checkSceneCollision(collisionPairs);
+
+		// Each pair is found from both of its nodes
+		std::sort(collisionPairs.begin(), collisionPairs.end());
+		collisionPairs.erase(std::unique(collisionPairs.begin(), collisionPairs.end()), collisionPairs.end());
 
 		for (auto collindingPair : collisionPairs)
 		{
@@ -327,22 +414,26 @@ namespace GEX
 		sounds_.removeStoppedSounds();
 	}
 
-	void World::draw()
+	void World::draw(RenderSnapshot& target)
 	{
-		if (PostEffect::isSupported())
-		{
-			// apply effects 
-			sceneTexture_.clear();
-			sceneTexture_.setView(worldView_);
-			sceneTexture_.draw(sceneGraph_);
-			sceneTexture_.display();
-			bloomEffect_.apply(sceneTexture_, target_);
-		}
-		else
+		// Paused, the previous state lags a tick behind: draw the world as it is so it holds still
+		const float alpha = SceneNode::getRenderInterpolation();
+		if (lastTick_ != SceneNode::getTick())
 		{
-			target_.setView(worldView_);
-			target_.draw(sceneGraph_);
+			SceneNode::setRenderInterpolation(1.f);
 		}
+
+		// The view scrolls with the scene, interpolate it the same way
+		sf::View view = worldView_;
+		view.setCenter(previousViewCenter_ + (worldView_.getCenter() - previousViewCenter_) * SceneNode::getRenderInterpolation());
+
+		// bloom is applied by the render thread when shaders are supported
+		target.beginPostEffect();
+		target.setView(view);
+		sceneGraph_.draw(target, sf::RenderStates::Default);
+		target.endPostEffect();
+
+		SceneNode::setRenderInterpolation(alpha);
 	}
 
 	CommandQueue & World::getCommandQueue()
@@ -386,11 +477,28 @@ namespace GEX
 		std::unique_ptr<SoundNode> sNode(new SoundNode(sounds_));
 		sceneGraph_.attachChild(std::move(sNode));
 
+		// Explosions of the destroyed enemies, drawn over the aircraft
+		std::unique_ptr<ExplosionNode> explosions(new ExplosionNode(textures_));
+		explosions_ = explosions.get();
+		sceneGraph_.attachChild(std::move(explosions));
+
+		// Health and missile displays, drawn on top of all the layers
+		std::unique_ptr<LabelBatchNode> labels(new LabelBatchNode(FontManager::getInstance().get(FontID::Main), 20));
+		labels_ = labels.get();
+		sceneGraph_.attachChild(std::move(labels));
+
+		// Bounding boxes, over everything else
+		std::unique_ptr<DebugDrawNode> debugDraw(new DebugDrawNode());
+		sceneGraph_.setDebugDraw(debugDraw.get());
+		sceneGraph_.attachChild(std::move(debugDraw));
+
 		//Particle System
 		std::unique_ptr<ParticleNode> smoke(new ParticleNode(Particle::Type::Smoke, textures_));
+		particleSystems_.add(*smoke);
 		sceneLayers_[LowerAir]->attachChild(std::move(smoke));
 
 		std::unique_ptr<ParticleNode> fire(new ParticleNode(Particle::Type::Propellant, textures_));
+		particleSystems_.add(*fire);
 		sceneLayers_[LowerAir]->attachChild(std::move(fire));
 
 		// background
@@ -410,11 +518,12 @@ namespace GEX
 
 		leader->setPosition(spawnPosition_);
 		leader->setVelocity(50.f, scrollSpeed_);
+		leader->setLabelBatch(labels_);
+		leader->setParticleRegistry(&particleSystems_);
+		// No explosion system, player_ stays valid until the game over screen
 		player_ = leader.get();
 		sceneLayers_[UpperAir]->attachChild(std::move(leader));
 
-		addEnemies();
-
 		
 	}
 }
\ No newline at end of file
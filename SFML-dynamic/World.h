@@ -33,14 +33,18 @@
 #include <SFML/Graphics/Texture.hpp>
 
 #include "SceneNode.h"
+#include "SceneRoot.h"
 #include "SpriteNode.h"
 #include "TextureManager.h"
 #include "Aircraft.h"
 #include <memory>
+#include <deque>
 #include <iostream>
 #include "CommandQueue.h"
-#include "BloomEffect.h"
 #include "SoundPlayer.h"
+#include "LevelLoader.h"
+#include "ParticleRegistry.h"
+#include "ExplosionNode.h"
 
 namespace sf  //Forward declaration - This class does not need to know about this class
 {
@@ -56,21 +60,26 @@ namespace GEX
 		explicit					World(sf::RenderTarget& window, SoundPlayer& sounds);
 
 		void						update(sf::Time dt, CommandQueue& commands);
-		void						draw();
+		void						draw(RenderSnapshot& target);
 
 		CommandQueue&				getCommandQueue();
 		bool						hasAlivePlayer() const;
 		bool						hasPlayerReachedEnd() const;
 
+		static sf::Time				getLevelLoadTime();		//of the last level loaded, for the stats overlay
+		static std::size_t			getLevelSpawnPoints();
+
 	private:
 		void						loadTextures();
 		void						buildScene();
 		void						adaptPlayerPosition();
 		void						adaptPlayerVelocity();
 
-		void						addEnemies();
+		void						addEnemies(const std::vector<SpawnData>& spawns);
 		void						addEnemy(AircraftType type, float relX, float relY);
 		void						spawnEmenies();
+		void						prewarmEnemies(float battlefieldTop);
+		std::unique_ptr<Aircraft>	createEnemy(AircraftType type, sf::Vector2f position);
 
 		sf::FloatRect				getViewBounds() const;
 		sf::FloatRect				getBattlefieldBounds() const;
@@ -83,6 +92,8 @@ namespace GEX
 
 		void						updateSound();
 
+		void						resetFrameData();
+
 	private:
 		enum Layer
 		{
@@ -107,14 +118,17 @@ namespace GEX
 
 	private:
 		const float					BORDER_DISTANCE = 40.f;
+		const sf::Time				PREWARM_TIME = sf::seconds(1.f);	//how far ahead enemies are built
+		const std::size_t			PREWARM_BUDGET = 2;					//enemies built per frame ahead of time
 
-		sf::RenderTarget&			target_;
-		sf::RenderTexture			sceneTexture_;
 		sf::View					worldView_;
+		sf::Vector2f				previousViewCenter_;
+		unsigned int				lastTick_;				//the world is paused when it was not updated in the last tick
 		TextureManager				textures_;
 		SoundPlayer&				sounds_;
 
-		SceneNode					sceneGraph_;
+		ParticleRegistry			particleSystems_;
+		SceneRoot					sceneGraph_;
 		std::vector<SceneNode*>		sceneLayers_;
 
 		sf::FloatRect				worldBounds_;
@@ -126,14 +140,21 @@ namespace GEX
 		Aircraft*					leftAircraft_;
 		Aircraft*					rightAircraft_;
 		SpriteNode*					background_;
+		LabelBatchNode*				labels_;
+		ExplosionNode*				explosions_;
 
 		CommandQueue				commandQueue_;
 
-		std::vector<SpawnPoint>		enemySpawnPoints_;
+		std::vector<SpawnPoint>		enemySpawnPoints_;		//in spawn order
+		std::size_t					nextSpawnPoint_;
+		std::size_t					nextPrewarmPoint_;
+		std::deque<std::unique_ptr<Aircraft>>	prewarmedEnemies_;	//built for [nextSpawnPoint_, nextPrewarmPoint_)
 
-		std::vector<Aircraft*>		activeEnemies_;
+		FrameArena					frameArena_;		//reset at the start of every update
+		FrameVector<Aircraft*>		activeEnemies_;		//filled by the guideMissiles commands
 
-		BloomEffect					bloomEffect_;
+		static sf::Time				levelLoadTime_;
+		static std::size_t			levelSpawnPoints_;
 
 	};
 